@@ -0,0 +1,256 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2026 Tim Blechmann
+
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <unordered_set>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <nova/non_null.hpp>
+
+// Each benchmark pairs a nova wrapper with the equivalent nullable code. The
+// nullable variants contain the null check that defensive code has to carry;
+// the non_null variants contain the same check, which the compiler hints should
+// fold away.
+
+namespace {
+
+constexpr std::size_t element_count = 4096;
+
+struct Node
+{
+    int value;
+};
+
+inline int read_checked( const Node* p )
+{
+    return p ? p->value : 0;
+}
+
+template < typename Ptr >
+inline int read_checked( const nova::non_null< Ptr >& p )
+{
+    return p.get() ? p->value : 0;
+}
+
+std::vector< Node > make_nodes()
+{
+    std::vector< Node > nodes( element_count );
+    for ( std::size_t i = 0; i != nodes.size(); ++i )
+        nodes[ i ].value = static_cast< int >( i );
+    return nodes;
+}
+
+} // namespace
+
+TEST_CASE( "raw pointer access", "[bench][non_null]" )
+{
+    std::vector< Node >                          nodes = make_nodes();
+    std::vector< const Node* >                   raw;
+    std::vector< nova::non_null< const Node* > > wrapped;
+    for ( const Node& n : nodes ) {
+        raw.push_back( &n );
+        wrapped.emplace_back( &n );
+    }
+
+    BENCHMARK( "T* checked read" )
+    {
+        int sum = 0;
+        for ( const Node* p : raw )
+            sum += read_checked( p );
+        return sum;
+    };
+
+    BENCHMARK( "non_null<T*> get() checked read" )
+    {
+        int sum = 0;
+        for ( const auto& p : wrapped )
+            sum += read_checked( p );
+        return sum;
+    };
+
+    BENCHMARK( "non_null<T*> operator->" )
+    {
+        int sum = 0;
+        for ( const auto& p : wrapped )
+            sum += p->value;
+        return sum;
+    };
+
+    BENCHMARK( "non_null<T*> operator*" )
+    {
+        int sum = 0;
+        for ( const auto& p : wrapped )
+            sum += ( *p ).value;
+        return sum;
+    };
+}
+
+TEST_CASE( "bulk validation", "[bench][non_null]" )
+{
+    std::vector< Node >        nodes = make_nodes();
+    std::vector< const Node* > raw;
+    for ( const Node& n : nodes )
+        raw.push_back( &n );
+
+    BENCHMARK( "try_make_non_null per element + sum" )
+    {
+        int sum = 0;
+        for ( const Node* p : raw ) {
+            auto nn = nova::try_make_non_null( p );
+            if ( !nn.has_value() )
+                return -1;
+            sum += ( *nn )->value;
+        }
+        return sum;
+    };
+
+    BENCHMARK( "try_make_non_null_range + sum" )
+    {
+        auto view = nova::try_make_non_null_range( raw );
+        if ( !view )
+            return -1;
+        int sum = 0;
+        for ( nova::non_null< const Node* > p : *view )
+            sum += p->value;
+        return sum;
+    };
+}
+
+TEST_CASE( "shared_ptr access", "[bench][shared_ptr]" )
+{
+    std::vector< std::shared_ptr< Node > >           raw;
+    std::vector< nova::non_null_shared_ptr< Node > > wrapped;
+    for ( std::size_t i = 0; i != element_count; ++i ) {
+        raw.push_back( std::make_shared< Node >( static_cast< int >( i ) ) );
+        wrapped.emplace_back( raw.back() );
+    }
+
+    BENCHMARK( "shared_ptr<T> checked read" )
+    {
+        int sum = 0;
+        for ( const auto& p : raw )
+            sum += read_checked( p.get() );
+        return sum;
+    };
+
+    BENCHMARK( "non_null_shared_ptr<T> get() checked read" )
+    {
+        int sum = 0;
+        for ( const auto& p : wrapped )
+            sum += read_checked( p );
+        return sum;
+    };
+}
+
+TEST_CASE( "unique_ptr ownership transfer", "[bench][unique_ptr]" )
+{
+    BENCHMARK_ADVANCED( "unique_ptr move" )( Catch::Benchmark::Chronometer meter )
+    {
+        std::vector< std::unique_ptr< Node > > src( static_cast< std::size_t >( meter.runs() ) );
+        for ( auto& p : src )
+            p = std::make_unique< Node >( 1 );
+        std::vector< std::unique_ptr< Node > > dst( src.size() );
+
+        meter.measure( [ & ]( int i ) {
+            auto idx   = static_cast< std::size_t >( i );
+            dst[ idx ] = std::move( src[ idx ] );
+            return dst[ idx ] ? dst[ idx ]->value : 0;
+        } );
+    };
+
+    BENCHMARK_ADVANCED( "non_null_unique_ptr take() + re-wrap" )( Catch::Benchmark::Chronometer meter )
+    {
+        std::deque< nova::non_null_unique_ptr< Node > > src;
+        for ( int i = 0; i != meter.runs(); ++i )
+            src.emplace_back( std::make_unique< Node >( 1 ) );
+        std::deque< nova::optional_non_null< std::unique_ptr< Node > > > dst( src.size() );
+
+        meter.measure( [ & ]( int i ) {
+            auto idx   = static_cast< std::size_t >( i );
+            dst[ idx ] = nova::optional_non_null< std::unique_ptr< Node > >( take( std::move( src[ idx ] ) ) );
+            return dst[ idx ]->value;
+        } );
+    };
+}
+
+TEST_CASE( "containers of owning pointers", "[bench][unique_ptr]" )
+{
+    BENCHMARK( "deque<unique_ptr<T>> build + checked sum" )
+    {
+        std::deque< std::unique_ptr< Node > > d;
+        for ( std::size_t i = 0; i != element_count; ++i )
+            d.emplace_back( std::make_unique< Node >( static_cast< int >( i ) ) );
+
+        int sum = 0;
+        for ( const auto& p : d )
+            sum += read_checked( p.get() );
+        return sum;
+    };
+
+    BENCHMARK( "deque<non_null_unique_ptr<T>> build + checked sum" )
+    {
+        std::deque< nova::non_null_unique_ptr< Node > > d;
+        for ( std::size_t i = 0; i != element_count; ++i )
+            d.emplace_back( std::make_unique< Node >( static_cast< int >( i ) ) );
+
+        int sum = 0;
+        for ( const auto& p : d )
+            sum += read_checked( p );
+        return sum;
+    };
+
+    std::deque< std::unique_ptr< Node > >           raw;
+    std::deque< nova::non_null_unique_ptr< Node > > wrapped;
+    for ( std::size_t i = 0; i != element_count; ++i ) {
+        raw.emplace_back( std::make_unique< Node >( static_cast< int >( i ) ) );
+        wrapped.emplace_back( std::make_unique< Node >( static_cast< int >( i ) ) );
+    }
+
+    BENCHMARK( "deque<unique_ptr<T>> checked sum" )
+    {
+        int sum = 0;
+        for ( const auto& p : raw )
+            sum += read_checked( p.get() );
+        return sum;
+    };
+
+    BENCHMARK( "deque<non_null_unique_ptr<T>> checked sum" )
+    {
+        int sum = 0;
+        for ( const auto& p : wrapped )
+            sum += read_checked( p );
+        return sum;
+    };
+}
+
+TEST_CASE( "pointer set lookup", "[bench][non_null_flat_set]" )
+{
+    std::vector< Node >                    nodes = make_nodes();
+    std::unordered_set< const Node* >      std_set;
+    nova::non_null_flat_set< const Node* > flat_set;
+    for ( std::size_t i = 0; i < nodes.size(); i += 2 ) {
+        std_set.insert( &nodes[ i ] );
+        flat_set.insert( nova::non_null< const Node* >( &nodes[ i ] ) );
+    }
+
+    BENCHMARK( "unordered_set<T*> contains" )
+    {
+        int hits = 0;
+        for ( const Node& n : nodes )
+            hits += std_set.contains( &n ) ? 1 : 0;
+        return hits;
+    };
+
+    BENCHMARK( "non_null_flat_set<T*> contains" )
+    {
+        int hits = 0;
+        for ( const Node& n : nodes )
+            hits += flat_set.contains( &n ) ? 1 : 0;
+        return hits;
+    };
+}
@@ -0,0 +1,175 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2026 Tim Blechmann
+
+#include <array>
+#include <cstddef>
+#include <deque>
+#include <functional>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <nova/non_null.hpp>
+
+// Calls through the wrapper are compared with the std type it wraps. The std
+// variants are guarded by an explicit empty check, which callers of a nullable
+// callable have to carry; the nova variants guarantee a non-empty callable.
+
+namespace {
+
+constexpr int call_count = 4096;
+
+struct Accumulator
+{
+    std::array< int, 8 > state {}; // large enough to defeat some small-buffer optimisations
+    int                  operator()( int x )
+    {
+        state[ 0 ] += x;
+        return state[ 0 ];
+    }
+};
+
+template < typename F >
+int call_checked( F& fn )
+{
+    int sum = 0;
+    for ( int i = 0; i != call_count; ++i )
+        sum += fn ? fn( i ) : 0;
+    return sum;
+}
+
+template < typename F >
+int call_unchecked( F& fn )
+{
+    int sum = 0;
+    for ( int i = 0; i != call_count; ++i )
+        sum += fn( i );
+    return sum;
+}
+
+int call_through_ref( nova::non_null_function_ref< int( int ) > fn )
+{
+    return call_unchecked( fn );
+}
+
+} // namespace
+
+TEST_CASE( "copyable function call", "[bench][non_null_function]" )
+{
+    std::function< int( int ) >           std_fn { Accumulator {} };
+    nova::non_null_function< int( int ) > nn_fn { Accumulator {} };
+
+    BENCHMARK( "std::function checked call" )
+    {
+        return call_checked( std_fn );
+    };
+
+    BENCHMARK( "non_null_function call" )
+    {
+        return call_checked( nn_fn );
+    };
+
+    BENCHMARK( "non_null_function_ref call" )
+    {
+        Accumulator acc;
+        return call_through_ref( acc );
+    };
+
+    BENCHMARK( "non_null_fn_ptr call" )
+    {
+        nova::non_null_fn_ptr< int( int ) > fn = []( int x ) {
+            return x + 1;
+        };
+        return call_unchecked( fn );
+    };
+
+    BENCHMARK( "std::function construct + call" )
+    {
+        std::function< int( int ) > fn { Accumulator {} };
+        return fn ? fn( 1 ) : 0;
+    };
+
+    BENCHMARK( "non_null_function construct + call" )
+    {
+        nova::non_null_function< int( int ) > fn { Accumulator {} };
+        return fn( 1 );
+    };
+
+    BENCHMARK( "non_null_inplace_function construct + call" )
+    {
+        nova::non_null_inplace_function< int( int ), sizeof( Accumulator ) > fn { Accumulator {} };
+        return fn( 1 );
+    };
+}
+
+#if defined( __cpp_lib_move_only_function ) && __cpp_lib_move_only_function >= 202110L
+
+TEST_CASE( "move-only function call", "[bench][non_null_move_only_function]" )
+{
+    std::move_only_function< int( int ) >           std_fn { Accumulator {} };
+    nova::non_null_move_only_function< int( int ) > nn_fn { Accumulator {} };
+
+    BENCHMARK( "std::move_only_function checked call" )
+    {
+        return call_checked( std_fn );
+    };
+
+    BENCHMARK( "non_null_move_only_function call" )
+    {
+        return call_checked( nn_fn );
+    };
+
+    BENCHMARK( "std::move_only_function construct + call" )
+    {
+        std::move_only_function< int( int ) > fn { Accumulator {} };
+        return fn ? fn( 1 ) : 0;
+    };
+
+    BENCHMARK( "non_null_move_only_function construct + call" )
+    {
+        nova::non_null_move_only_function< int( int ) > fn { Accumulator {} };
+        return fn( 1 );
+    };
+}
+
+TEST_CASE( "task queue", "[bench][non_null_task_queue]" )
+{
+    constexpr std::size_t batch = 256;
+
+    struct Task
+    {
+        std::array< int, 8 >* target;
+        std::array< int, 7 >  payload; // too large for the small buffer of std::move_only_function
+
+        void operator()()
+        {
+            ( *target )[ 0 ] += payload[ 0 ];
+        }
+    };
+
+    std::array< int, 8 > target {};
+
+    BENCHMARK( "deque<std::move_only_function> push + checked run" )
+    {
+        std::deque< std::move_only_function< void() > > queue;
+        for ( std::size_t i = 0; i != batch; ++i )
+            queue.emplace_back( Task { &target, { 1 } } );
+        while ( !queue.empty() ) {
+            if ( queue.front() )
+                queue.front()();
+            queue.pop_front();
+        }
+        return target[ 0 ];
+    };
+
+    BENCHMARK( "non_null_task_queue emplace + run" )
+    {
+        nova::non_null_task_queue< batch, sizeof( Task ) > queue;
+        for ( std::size_t i = 0; i != batch; ++i )
+            queue.emplace( Task { &target, { 1 } } );
+        queue.run_pending();
+        return target[ 0 ];
+    };
+}
+
+#endif // __cpp_lib_move_only_function
@@ -0,0 +1,318 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2026 Tim Blechmann
+
+#pragma once
+
+#include <nova/non_null/core.hpp>
+
+#include <memory_resource>
+
+#include <nova/non_null/detail/prologue.hpp>
+
+namespace nova {
+
+// =============================================================================
+// allocator-aware factories
+// =============================================================================
+
+namespace detail {
+
+/**
+ * @brief Concept: A is usable as an allocator by the allocate_non_null_* factories.
+ * Excludes std::pmr::memory_resource*, which has its own overloads.
+ */
+template < typename A >
+concept allocator_like = requires( A& a ) {
+    typename A::value_type;
+    a.deallocate( a.allocate( std::size_t( 1 ) ), std::size_t( 1 ) );
+};
+
+template < typename T, typename Alloc >
+using rebind_alloc_t = typename std::allocator_traits< Alloc >::template rebind_alloc< T >;
+
+// Deallocates n objects at ptr unless released; destroys the first
+// `constructed` of them first. Used instead of try/catch so the factories
+// also work with -fno-exceptions.
+template < typename Alloc >
+struct allocation_guard
+{
+    using traits  = std::allocator_traits< Alloc >;
+    using pointer = typename traits::pointer;
+
+    Alloc&      alloc;
+    pointer     ptr;
+    std::size_t n;
+    std::size_t constructed = 0;
+
+    ~allocation_guard()
+    {
+        if ( !ptr )
+            return;
+        while ( constructed != 0 )
+            traits::destroy( alloc, std::to_address( ptr + --constructed ) );
+        traits::deallocate( alloc, ptr, n );
+    }
+
+    pointer release() noexcept
+    {
+        return std::exchange( ptr, nullptr );
+    }
+};
+
+} // namespace detail
+
+/**
+ * @brief A std::unique_ptr deleter that destroys and deallocates through an allocator.
+ *
+ * Returned by allocate_non_null_unique; the allocator is available through
+ * get_deleter().get_allocator().
+ *
+ * @tparam T     The object type, or U[] for arrays (the element count is stored).
+ * @tparam Alloc An allocator for T (rebound if necessary).
+ */
+template < typename T, typename Alloc >
+class allocator_delete
+{
+    using traits = std::allocator_traits< detail::rebind_alloc_t< T, Alloc > >;
+
+public:
+    using allocator_type = typename traits::allocator_type;
+
+    static_assert( std::is_same_v< typename traits::pointer, T* >,
+                   "nova::allocator_delete: fancy allocator pointers are not supported" );
+
+    explicit allocator_delete( const allocator_type& alloc ) noexcept :
+        alloc_( alloc )
+    {}
+
+    void operator()( T* NOVA_NONNULL p ) noexcept
+    {
+        traits::destroy( alloc_, p );
+        traits::deallocate( alloc_, p, 1 );
+    }
+
+    allocator_type get_allocator() const noexcept
+    {
+        return alloc_;
+    }
+
+private:
+    [[no_unique_address]] allocator_type alloc_;
+};
+
+template < typename T, typename Alloc >
+class allocator_delete< T[], Alloc >
+{
+    using traits = std::allocator_traits< detail::rebind_alloc_t< T, Alloc > >;
+
+public:
+    using allocator_type = typename traits::allocator_type;
+
+    static_assert( std::is_same_v< typename traits::pointer, T* >,
+                   "nova::allocator_delete: fancy allocator pointers are not supported" );
+
+    allocator_delete( const allocator_type& alloc, std::size_t size ) noexcept :
+        alloc_( alloc ),
+        size_( size )
+    {}
+
+    void operator()( T* NOVA_NONNULL p ) noexcept
+    {
+        for ( std::size_t i = size_; i != 0; --i )
+            traits::destroy( alloc_, p + ( i - 1 ) );
+        traits::deallocate( alloc_, p, size_ );
+    }
+
+    allocator_type get_allocator() const noexcept
+    {
+        return alloc_;
+    }
+
+    /**
+     * @brief Returns the number of elements in the array.
+     */
+    std::size_t size() const noexcept
+    {
+        return size_;
+    }
+
+private:
+    [[no_unique_address]] allocator_type alloc_;
+    std::size_t                          size_;
+};
+
+namespace detail {
+
+template < typename T, typename Alloc >
+using allocator_delete_for = allocator_delete< T, rebind_alloc_t< std::remove_extent_t< T >, Alloc > >;
+
+} // namespace detail
+
+/**
+ * @brief The non_null<std::unique_ptr> returned by allocate_non_null_unique<T>( Alloc ).
+ */
+template < typename T, typename Alloc >
+using non_null_allocated_unique_ptr = non_null< std::unique_ptr< T, detail::allocator_delete_for< T, Alloc > > >;
+
+/**
+ * @brief The non_null<std::unique_ptr> returned by allocate_non_null_unique<T>( std::pmr::memory_resource* ).
+ */
+template < typename T >
+using non_null_pmr_unique_ptr = non_null_allocated_unique_ptr< T, std::pmr::polymorphic_allocator< std::byte > >;
+
+/**
+ * @brief Factory function that creates a non_null<std::unique_ptr<T, allocator_delete>>.
+ * Like make_non_null_unique, but the object is allocated and constructed through alloc.
+ * @tparam T The type to construct.
+ * @param alloc The allocator (rebound to T).
+ * @param args Arguments to forward to T's constructor.
+ */
+template < typename T, detail::allocator_like Alloc, typename... Args >
+    requires( !std::is_array_v< T > )
+non_null_allocated_unique_ptr< T, Alloc > allocate_non_null_unique( const Alloc& alloc, Args&&... args )
+{
+    using deleter    = detail::allocator_delete_for< T, Alloc >;
+    using alloc_type = typename deleter::allocator_type;
+    using traits     = std::allocator_traits< alloc_type >;
+
+    alloc_type                           a( alloc );
+    detail::allocation_guard< alloc_type > guard { a, traits::allocate( a, 1 ), 1 };
+    traits::construct( a, guard.ptr, std::forward< Args >( args )... );
+    guard.constructed = 1;
+
+    T* p = guard.release();
+    return non_null( std::unique_ptr< T, deleter >( p, deleter( a ) ) );
+}
+
+/**
+ * @brief Array form: allocates n value-initialised elements through alloc.
+ */
+template < typename T, detail::allocator_like Alloc >
+    requires std::is_unbounded_array_v< T >
+non_null_allocated_unique_ptr< T, Alloc > allocate_non_null_unique( const Alloc& alloc, std::size_t n )
+{
+    using deleter    = detail::allocator_delete_for< T, Alloc >;
+    using alloc_type = typename deleter::allocator_type;
+    using traits     = std::allocator_traits< alloc_type >;
+
+    alloc_type                           a( alloc );
+    detail::allocation_guard< alloc_type > guard { a, traits::allocate( a, n ), n };
+    for ( ; guard.constructed != n; ++guard.constructed )
+        traits::construct( a, guard.ptr + guard.constructed );
+
+    auto* p = guard.release();
+    return non_null( std::unique_ptr< T, deleter >( p, deleter( a, n ) ) );
+}
+
+/**
+ * @brief Like allocate_non_null_unique, but default-initialises the object
+ *        (no zeroing of trivial types). Cf. std::make_unique_for_overwrite.
+ */
+template < typename T, detail::allocator_like Alloc >
+    requires( !std::is_array_v< T > )
+non_null_allocated_unique_ptr< T, Alloc > allocate_non_null_unique_for_overwrite( const Alloc& alloc )
+{
+    using deleter    = detail::allocator_delete_for< T, Alloc >;
+    using alloc_type = typename deleter::allocator_type;
+    using traits     = std::allocator_traits< alloc_type >;
+
+    alloc_type                           a( alloc );
+    detail::allocation_guard< alloc_type > guard { a, traits::allocate( a, 1 ), 1 };
+    ::new ( static_cast< void* >( guard.ptr ) ) T;
+
+    T* p = guard.release();
+    return non_null( std::unique_ptr< T, deleter >( p, deleter( a ) ) );
+}
+
+/**
+ * @brief Array form: allocates n default-initialised elements through alloc.
+ */
+template < typename T, detail::allocator_like Alloc >
+    requires std::is_unbounded_array_v< T >
+non_null_allocated_unique_ptr< T, Alloc > allocate_non_null_unique_for_overwrite( const Alloc& alloc, std::size_t n )
+{
+    using deleter    = detail::allocator_delete_for< T, Alloc >;
+    using alloc_type = typename deleter::allocator_type;
+    using traits     = std::allocator_traits< alloc_type >;
+    using element    = std::remove_extent_t< T >;
+
+    alloc_type                           a( alloc );
+    detail::allocation_guard< alloc_type > guard { a, traits::allocate( a, n ), n };
+    for ( ; guard.constructed != n; ++guard.constructed )
+        ::new ( static_cast< void* >( guard.ptr + guard.constructed ) ) element;
+
+    auto* p = guard.release();
+    return non_null( std::unique_ptr< T, deleter >( p, deleter( a, n ) ) );
+}
+
+/**
+ * @brief Factory function that creates a non_null<std::shared_ptr<T>> through alloc.
+ * Similar to std::allocate_shared (including the T[] and T[N] forms), but
+ * returns a non-null wrapper.
+ */
+template < typename T, detail::allocator_like Alloc, typename... Args >
+inline non_null< std::shared_ptr< T > > allocate_non_null_shared( const Alloc& alloc, Args&&... args )
+{
+    return non_null( std::allocate_shared< T >( alloc, std::forward< Args >( args )... ) );
+}
+
+#if defined( __cpp_lib_smart_ptr_for_overwrite ) && __cpp_lib_smart_ptr_for_overwrite >= 202002L
+/**
+ * @brief Like allocate_non_null_shared, but default-initialises the object or
+ *        array elements. Cf. std::allocate_shared_for_overwrite.
+ */
+template < typename T, detail::allocator_like Alloc, typename... Args >
+inline non_null< std::shared_ptr< T > > allocate_non_null_shared_for_overwrite( const Alloc& alloc, Args&&... args )
+{
+    return non_null( std::allocate_shared_for_overwrite< T >( alloc, std::forward< Args >( args )... ) );
+}
+#endif
+
+// --- std::pmr::memory_resource overloads ---------------------------------------
+
+/**
+ * @brief allocate_non_null_unique through a std::pmr::memory_resource, which must not be null.
+ */
+template < typename T, typename... Args >
+non_null_pmr_unique_ptr< T > allocate_non_null_unique( std::pmr::memory_resource* NOVA_NONNULL mr, Args&&... args )
+{
+    assert( mr && "nova::allocate_non_null_unique: memory resource cannot be null" );
+    return allocate_non_null_unique< T >( std::pmr::polymorphic_allocator< std::byte >( mr ),
+                                          std::forward< Args >( args )... );
+}
+
+template < typename T, typename... Args >
+non_null_pmr_unique_ptr< T > allocate_non_null_unique_for_overwrite( std::pmr::memory_resource* NOVA_NONNULL mr,
+                                                                     Args&&... args )
+{
+    assert( mr && "nova::allocate_non_null_unique_for_overwrite: memory resource cannot be null" );
+    return allocate_non_null_unique_for_overwrite< T >( std::pmr::polymorphic_allocator< std::byte >( mr ),
+                                                        std::forward< Args >( args )... );
+}
+
+template < typename T, typename... Args >
+non_null< std::shared_ptr< T > > allocate_non_null_shared( std::pmr::memory_resource* NOVA_NONNULL mr, Args&&... args )
+{
+    assert( mr && "nova::allocate_non_null_shared: memory resource cannot be null" );
+    return allocate_non_null_shared< T >( std::pmr::polymorphic_allocator< std::byte >( mr ),
+                                          std::forward< Args >( args )... );
+}
+
+#if defined( __cpp_lib_smart_ptr_for_overwrite ) && __cpp_lib_smart_ptr_for_overwrite >= 202002L
+template < typename T, typename... Args >
+non_null< std::shared_ptr< T > > allocate_non_null_shared_for_overwrite( std::pmr::memory_resource* NOVA_NONNULL mr,
+                                                                         Args&&... args )
+{
+    assert( mr && "nova::allocate_non_null_shared_for_overwrite: memory resource cannot be null" );
+    return allocate_non_null_shared_for_overwrite< T >( std::pmr::polymorphic_allocator< std::byte >( mr ),
+                                                        std::forward< Args >( args )... );
+}
+#endif
+
+template < typename T, typename Alloc >
+struct is_trivially_relocatable< allocator_delete< T, Alloc > > : is_trivially_relocatable< Alloc >
+{};
+
+} // namespace nova
+
+#include <nova/non_null/detail/epilogue.hpp>
@@ -0,0 +1,552 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2026 Tim Blechmann
+
+#pragma once
+
+#include <nova/non_null/core.hpp>
+
+#include <atomic>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+#include <nova/non_null/detail/prologue.hpp>
+
+namespace nova {
+
+// =============================================================================
+// non_null_atomic
+// =============================================================================
+
+/**
+ * @brief Primary template declaration — only the raw pointer specialisation
+ *        below is defined.
+ */
+template < typename T >
+class non_null_atomic;
+
+/**
+ * @brief A lock-free atomic raw pointer that can never be observed as null.
+ *
+ * Wraps std::atomic<T*>; every operation accepts or returns non_null<T*>, so the
+ * assume_nonnull hint flows into reader code and the compiler can drop null
+ * branches after load(). sizeof(non_null_atomic<T*>) == sizeof(T*).
+ */
+template < typename T >
+class non_null_atomic< T* >
+{
+public:
+    using value_type = non_null< T* >;
+
+    static constexpr bool is_always_lock_free = std::atomic< T* >::is_always_lock_free;
+    static_assert( is_always_lock_free, "nova::non_null_atomic: std::atomic<T*> must be lock-free" );
+
+    /**
+     * @brief Constructs the atomic from a non-null pointer.
+     */
+    constexpr explicit non_null_atomic( non_null< T* > p ) noexcept :
+        ptr_( p.get() )
+    {}
+
+    non_null_atomic( const non_null_atomic& )            = delete;
+    non_null_atomic& operator=( const non_null_atomic& ) = delete;
+
+    // Disable null construction and null assignment
+    non_null_atomic( std::nullptr_t )            = delete;
+    non_null_atomic& operator=( std::nullptr_t ) = delete;
+
+    /**
+     * @brief Atomically loads the pointer.
+     */
+    non_null< T* > load( std::memory_order order = std::memory_order_seq_cst ) const noexcept
+    {
+        return assume_loaded( ptr_.load( order ) );
+    }
+
+    operator non_null< T* >() const noexcept
+    {
+        return load();
+    }
+
+    /**
+     * @brief Atomically replaces the pointer.
+     */
+    void store( non_null< T* > desired, std::memory_order order = std::memory_order_seq_cst ) noexcept
+    {
+        ptr_.store( desired.get(), order );
+    }
+
+    non_null< T* > operator=( non_null< T* > desired ) noexcept
+    {
+        store( desired );
+        return desired;
+    }
+
+    /**
+     * @brief Atomically replaces the pointer and returns the previous one.
+     */
+    non_null< T* > exchange( non_null< T* > desired, std::memory_order order = std::memory_order_seq_cst ) noexcept
+    {
+        return assume_loaded( ptr_.exchange( desired.get(), order ) );
+    }
+
+    /**
+     * @brief Atomic compare-and-exchange. On failure, expected receives the
+     *        current (non-null) value.
+     */
+    bool compare_exchange_weak( non_null< T* >&   expected,
+                                non_null< T* >    desired,
+                                std::memory_order success,
+                                std::memory_order failure ) noexcept
+    {
+        T* current = expected.get();
+        if ( ptr_.compare_exchange_weak( current, desired.get(), success, failure ) )
+            return true;
+        expected = assume_loaded( current );
+        return false;
+    }
+
+    bool compare_exchange_weak( non_null< T* >&   expected,
+                                non_null< T* >    desired,
+                                std::memory_order order = std::memory_order_seq_cst ) noexcept
+    {
+        T* current = expected.get();
+        if ( ptr_.compare_exchange_weak( current, desired.get(), order ) )
+            return true;
+        expected = assume_loaded( current );
+        return false;
+    }
+
+    bool compare_exchange_strong( non_null< T* >&   expected,
+                                  non_null< T* >    desired,
+                                  std::memory_order success,
+                                  std::memory_order failure ) noexcept
+    {
+        T* current = expected.get();
+        if ( ptr_.compare_exchange_strong( current, desired.get(), success, failure ) )
+            return true;
+        expected = assume_loaded( current );
+        return false;
+    }
+
+    bool compare_exchange_strong( non_null< T* >&   expected,
+                                  non_null< T* >    desired,
+                                  std::memory_order order = std::memory_order_seq_cst ) noexcept
+    {
+        T* current = expected.get();
+        if ( ptr_.compare_exchange_strong( current, desired.get(), order ) )
+            return true;
+        expected = assume_loaded( current );
+        return false;
+    }
+
+#if defined( __cpp_lib_atomic_wait ) && __cpp_lib_atomic_wait >= 201907L
+    /**
+     * @brief Blocks until the pointer differs from old (C++20 atomic wait).
+     */
+    void wait( non_null< T* > old, std::memory_order order = std::memory_order_seq_cst ) const noexcept
+    {
+        ptr_.wait( old.get(), order );
+    }
+
+    void notify_one() noexcept
+    {
+        ptr_.notify_one();
+    }
+
+    void notify_all() noexcept
+    {
+        ptr_.notify_all();
+    }
+#endif
+
+    bool is_lock_free() const noexcept
+    {
+        return ptr_.is_lock_free();
+    }
+
+private:
+    static non_null< T* > assume_loaded( T* p ) noexcept
+    {
+        detail::assume_nonnull( p );
+        return non_null< T* >( p );
+    }
+
+    std::atomic< T* > ptr_;
+};
+
+template < typename T >
+non_null_atomic( non_null< T* > ) -> non_null_atomic< T* >;
+
+namespace detail {
+
+/**
+ * @brief Per-thread hazard pointer slots used by the snapshot readers of
+ *        non_null_atomic<std::shared_ptr<T>>.
+ *
+ * Records are kept in a global, grow-only lock-free list. A thread claims one
+ * record on first use and hands it back at thread exit; records are never freed.
+ * Each record occupies its own cache lines, so readers only ever write to memory
+ * owned by their own thread.
+ */
+struct alignas( 64 ) hazard_record
+{
+    static constexpr std::size_t slot_count = 4;
+
+    std::atomic< const void* > slots[ slot_count ] = {};
+    std::atomic< bool >        active { false };
+    hazard_record*             next = nullptr;
+};
+
+inline std::atomic< hazard_record* > hazard_records { nullptr };
+
+inline hazard_record* claim_hazard_record()
+{
+    for ( hazard_record* rec = hazard_records.load( std::memory_order_acquire ); rec; rec = rec->next ) {
+        bool expected = false;
+        if ( !rec->active.load( std::memory_order_relaxed )
+             && rec->active.compare_exchange_strong( expected, true, std::memory_order_acquire ) )
+            return rec;
+    }
+
+    auto* rec = new hazard_record;
+    rec->active.store( true, std::memory_order_relaxed );
+    rec->next = hazard_records.load( std::memory_order_relaxed );
+    while ( !hazard_records.compare_exchange_weak(
+        rec->next, rec, std::memory_order_release, std::memory_order_relaxed ) ) {}
+    return rec;
+}
+
+struct hazard_record_owner
+{
+    hazard_record* record = claim_hazard_record();
+
+    hazard_record_owner()                                        = default;
+    hazard_record_owner( const hazard_record_owner& )            = delete;
+    hazard_record_owner& operator=( const hazard_record_owner& ) = delete;
+
+    ~hazard_record_owner()
+    {
+        for ( auto& slot : record->slots )
+            slot.store( nullptr, std::memory_order_release );
+        record->active.store( false, std::memory_order_release );
+    }
+};
+
+/**
+ * @brief Returns a free hazard slot of the calling thread, or nullptr if all
+ *        slots are in use.
+ */
+inline std::atomic< const void* >* acquire_hazard_slot()
+{
+    thread_local hazard_record_owner owner;
+    for ( auto& slot : owner.record->slots )
+        if ( slot.load( std::memory_order_relaxed ) == nullptr )
+            return &slot;
+    return nullptr;
+}
+
+/**
+ * @brief Returns true if any thread currently protects p.
+ */
+inline bool is_hazardous( const void* p ) noexcept
+{
+    for ( hazard_record* rec = hazard_records.load( std::memory_order_acquire ); rec; rec = rec->next )
+        for ( const auto& slot : rec->slots )
+            if ( slot.load( std::memory_order_seq_cst ) == p )
+                return true;
+    return false;
+}
+
+} // namespace detail
+
+/**
+ * @brief An atomic holder of non_null<std::shared_ptr<T>> for read-mostly data.
+ *
+ * Readers call snapshot() to obtain a non-null view of the current value without
+ * touching the shared_ptr control block: the current value is protected by a
+ * per-thread hazard pointer, so the fast path writes only to thread-owned cache
+ * lines and scales with the number of reader cores. If a thread holds more
+ * snapshots than it has hazard slots, further snapshots fall back to copying the
+ * shared_ptr.
+ *
+ * Writers (store, exchange, compare_exchange_strong) are serialised by a mutex.
+ * A replaced value that no reader protects is released by the writer that
+ * replaced it; otherwise it is retired, and it stays alive (and counted in
+ * use_count()) until the last snapshot protecting it is destroyed, which then
+ * takes the writer mutex to release it. reclaim() releases retired values
+ * explicitly. load() returns an owning copy (one reference count increment).
+ *
+ * Snapshots must not outlive the holder.
+ */
+template < typename T >
+class non_null_atomic< std::shared_ptr< T > >
+{
+    struct node
+    {
+        non_null< std::shared_ptr< T > > value;
+    };
+
+public:
+    using value_type = non_null< std::shared_ptr< T > >;
+
+    static constexpr bool is_always_lock_free = false;
+
+    /**
+     * @brief A non-null, non-owning view of the held value at the time of the
+     *        snapshot() call. Remains valid while the snapshot is alive, even if
+     *        the holder is updated in the meantime.
+     */
+    class snapshot_type
+    {
+    public:
+        snapshot_type( const snapshot_type& )            = delete;
+        snapshot_type& operator=( const snapshot_type& ) = delete;
+
+        ~snapshot_type()
+        {
+            if ( slot_ ) {
+                slot_->store( nullptr, std::memory_order_seq_cst );
+                if ( owner_->retired_pending_.load( std::memory_order_seq_cst ) ) [[unlikely]]
+                    owner_->reclaim_retired();
+            }
+        }
+
+        /**
+         * @brief Returns the raw pointer to the held object.
+         */
+        T* NOVA_NONNULL get() const noexcept NOVA_RETURNS_NONNULL
+        {
+            return value_->get();
+        }
+
+        T* NOVA_NONNULL operator->() const noexcept NOVA_RETURNS_NONNULL
+        {
+            return get();
+        }
+
+        T& operator*() const noexcept
+        {
+            return *get();
+        }
+
+        /**
+         * @brief Returns a non_null<T*> that must not outlive the snapshot
+         *        (lifetimebound).
+         */
+        non_null< T* > borrow() const& noexcept NOVA_LIFETIMEBOUND
+        {
+            return non_null< T* >( get() );
+        }
+
+        non_null< T* > borrow() && noexcept = delete;
+
+        /**
+         * @brief Returns the held non_null<std::shared_ptr<T>>, e.g. for use_count(),
+         *        owner comparisons, or to copy it and extend its lifetime.
+         */
+        const non_null< std::shared_ptr< T > >& value() const noexcept
+        {
+            return *value_;
+        }
+
+        constexpr explicit operator bool() const noexcept
+        {
+            return true;
+        }
+
+    private:
+        friend class non_null_atomic;
+
+        snapshot_type( const non_null_atomic*                    owner,
+                       const non_null< std::shared_ptr< T > >* value,
+                       std::atomic< const void* >*             slot ) noexcept :
+            owner_( owner ),
+            value_( value ),
+            slot_( slot )
+        {}
+
+        explicit snapshot_type( non_null< std::shared_ptr< T > > fallback ) noexcept :
+            fallback_( std::move( fallback ) ),
+            value_( &*fallback_ )
+        {}
+
+        const non_null_atomic*                            owner_ = nullptr;
+        std::optional< non_null< std::shared_ptr< T > > > fallback_;
+        const non_null< std::shared_ptr< T > >*           value_;
+        std::atomic< const void* >*                       slot_ = nullptr;
+    };
+
+    /**
+     * @brief Constructs the holder from a non-null shared pointer.
+     */
+    explicit non_null_atomic( non_null< std::shared_ptr< T > > p ) :
+        head_( new node { std::move( p ) } )
+    {}
+
+    non_null_atomic( const non_null_atomic& )            = delete;
+    non_null_atomic& operator=( const non_null_atomic& ) = delete;
+
+    // Disable null construction and null assignment
+    non_null_atomic( std::nullptr_t )            = delete;
+    non_null_atomic& operator=( std::nullptr_t ) = delete;
+
+    ~non_null_atomic()
+    {
+        delete head_.load( std::memory_order_relaxed );
+        for ( node* n : retired_ )
+            delete n;
+    }
+
+    /**
+     * @brief Returns a view of the current value without reference count traffic.
+     */
+    snapshot_type snapshot() const
+    {
+        std::atomic< const void* >* slot = detail::acquire_hazard_slot();
+        if ( !slot )
+            return snapshot_type( load_locked() );
+
+        node* n = head_.load( std::memory_order_relaxed );
+        for ( ;; ) {
+            slot->store( n, std::memory_order_seq_cst );
+            node* current = head_.load( std::memory_order_seq_cst );
+            if ( current == n )
+                break;
+            n = current;
+        }
+        detail::assume_nonnull( n );
+        return snapshot_type( this, &n->value, slot );
+    }
+
+    /**
+     * @brief Returns an owning copy of the current value.
+     */
+    non_null< std::shared_ptr< T > > load() const
+    {
+        snapshot_type snap = snapshot();
+        return snap.value();
+    }
+
+    operator non_null< std::shared_ptr< T > >() const
+    {
+        return load();
+    }
+
+    /**
+     * @brief Replaces the held value.
+     */
+    void store( non_null< std::shared_ptr< T > > desired )
+    {
+        (void)exchange( std::move( desired ) );
+    }
+
+    /**
+     * @brief Replaces the held value and returns the previous one.
+     */
+    non_null< std::shared_ptr< T > > exchange( non_null< std::shared_ptr< T > > desired )
+    {
+        auto*                            n        = new node { std::move( desired ) };
+        std::lock_guard                  lock( writer_mutex_ );
+        node*                            old      = head_.exchange( n, std::memory_order_seq_cst );
+        non_null< std::shared_ptr< T > > previous = old->value;
+        retire( old );
+        return previous;
+    }
+
+    /**
+     * @brief Replaces the held value with desired if it is equivalent to expected
+     *        (same pointer and same owner), otherwise loads the current value into
+     *        expected.
+     */
+    bool compare_exchange_strong( non_null< std::shared_ptr< T > >& expected,
+                                  non_null< std::shared_ptr< T > >  desired )
+    {
+        std::lock_guard lock( writer_mutex_ );
+        node*           current = head_.load( std::memory_order_relaxed );
+        const auto&     value   = current->value;
+        if ( value.get() != expected.get() || value.owner_before( expected ) || expected.owner_before( value ) ) {
+            expected = value;
+            return false;
+        }
+
+        head_.store( new node { std::move( desired ) }, std::memory_order_seq_cst );
+        retire( current );
+        return true;
+    }
+
+    bool compare_exchange_weak( non_null< std::shared_ptr< T > >& expected, non_null< std::shared_ptr< T > > desired )
+    {
+        return compare_exchange_strong( expected, std::move( desired ) );
+    }
+
+    bool is_lock_free() const noexcept
+    {
+        return false;
+    }
+
+    /**
+     * @brief Releases the retired values that no reader protects any more.
+     *
+     * Destroying the last snapshot of a retired value already does this; call it
+     * e.g. after threads holding hazard slots have exited.
+     */
+    void reclaim()
+    {
+        reclaim_retired();
+    }
+
+private:
+    // Slow path when the calling thread has no free hazard slot: copy the value
+    // while holding the writer lock, so that the node cannot be reclaimed.
+    non_null< std::shared_ptr< T > > load_locked() const
+    {
+        std::lock_guard lock( writer_mutex_ );
+        return head_.load( std::memory_order_relaxed )->value;
+    }
+
+    // Requires writer_mutex_. retired_pending_ is raised before the hazard slots
+    // are scanned: a reader that clears its slot after the scan is then
+    // guaranteed to see it and reclaim the node itself.
+    void retire( node* old )
+    {
+        retired_.push_back( old );
+        retired_pending_.store( true, std::memory_order_seq_cst );
+        scan_retired();
+    }
+
+    void reclaim_retired() const
+    {
+        std::lock_guard lock( writer_mutex_ );
+        if ( !retired_.empty() )
+            scan_retired();
+    }
+
+    // Requires writer_mutex_.
+    void scan_retired() const
+    {
+        std::erase_if( retired_, []( node* n ) {
+            if ( detail::is_hazardous( n ) )
+                return false;
+            delete n;
+            return true;
+        } );
+        if ( retired_.empty() )
+            retired_pending_.store( false, std::memory_order_relaxed );
+    }
+
+    std::atomic< node* >         head_;
+    mutable std::mutex           writer_mutex_;
+    mutable std::vector< node* > retired_;
+    mutable std::atomic< bool >  retired_pending_ { false };
+};
+
+template < typename T >
+non_null_atomic( non_null< std::shared_ptr< T > > ) -> non_null_atomic< std::shared_ptr< T > >;
+
+template < typename T >
+using non_null_atomic_shared_ptr = non_null_atomic< std::shared_ptr< T > >;
+
+} // namespace nova
+
+#include <nova/non_null/detail/epilogue.hpp>
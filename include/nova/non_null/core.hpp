@@ -0,0 +1,1002 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2026 Tim Blechmann
+
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <source_location>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include <nova/non_null/detail/prologue.hpp>
+
+namespace nova {
+
+// =============================================================================
+// instrumentation
+// =============================================================================
+
+/**
+ * @brief Per-thread event counts, collected when NOVA_INSTRUMENTATION is 1.
+ *
+ * Instrumentation is off by default, in which case the hooks compile to
+ * nothing and the counters stay zero. NOVA_INSTRUMENTATION must have the same
+ * value in every translation unit of a program.
+ */
+struct instrumentation_counters
+{
+    std::uint64_t constructions    = 0; ///< Wrappers validated from a pointer or callable
+    std::uint64_t copies           = 0; ///< Copy constructions and copy assignments
+    std::uint64_t takes            = 0; ///< take() calls
+    std::uint64_t inline_callables = 0; ///< Function wrappers whose callable is stored inline
+    std::uint64_t heap_callables   = 0; ///< Function wrappers whose callable is heap-allocated
+};
+
+inline constexpr bool instrumentation_enabled = NOVA_INSTRUMENTATION != 0;
+
+namespace detail {
+
+#if NOVA_INSTRUMENTATION
+inline instrumentation_counters& thread_counters() noexcept
+{
+    thread_local instrumentation_counters counters;
+    return counters;
+}
+#endif
+
+} // namespace detail
+
+/**
+ * @brief Returns the counters of the calling thread.
+ */
+inline instrumentation_counters get_instrumentation_counters() noexcept
+{
+#if NOVA_INSTRUMENTATION
+    return detail::thread_counters();
+#else
+    return {};
+#endif
+}
+
+/**
+ * @brief Resets the counters of the calling thread.
+ */
+inline void reset_instrumentation_counters() noexcept
+{
+#if NOVA_INSTRUMENTATION
+    detail::thread_counters() = {};
+#endif
+}
+
+namespace detail {
+
+// Instrumentation hooks: empty unless NOVA_INSTRUMENTATION is 1.
+constexpr void nova_count_construction() noexcept
+{
+#if NOVA_INSTRUMENTATION
+    if ( !std::is_constant_evaluated() )
+        ++thread_counters().constructions;
+#endif
+}
+
+constexpr void nova_count_copy() noexcept
+{
+#if NOVA_INSTRUMENTATION
+    if ( !std::is_constant_evaluated() )
+        ++thread_counters().copies;
+#endif
+}
+
+constexpr void nova_count_take() noexcept
+{
+#if NOVA_INSTRUMENTATION
+    if ( !std::is_constant_evaluated() )
+        ++thread_counters().takes;
+#endif
+}
+
+constexpr void nova_count_callable( [[maybe_unused]] bool stored_inline ) noexcept
+{
+#if NOVA_INSTRUMENTATION
+    if ( !std::is_constant_evaluated() )
+        ++( stored_inline ? thread_counters().inline_callables : thread_counters().heap_callables );
+#endif
+}
+
+// Poison the storage of a taken wrapper so that a use-after-take is reported by
+// ASAN. Constant evaluation has no shadow memory, so both are no-ops there and
+// take() stays constexpr in ASAN builds.
+constexpr void nova_asan_poison( [[maybe_unused]] void const* NOVA_NONNULL p,
+                                 [[maybe_unused]] std::size_t              s ) noexcept
+{
+#if defined( NOVA_HAVE_ASAN )
+    if ( !std::is_constant_evaluated() )
+        __asan_poison_memory_region( p, s );
+#endif
+}
+
+constexpr void nova_asan_unpoison( [[maybe_unused]] void const* NOVA_NONNULL p,
+                                   [[maybe_unused]] std::size_t              s ) noexcept
+{
+#if defined( NOVA_HAVE_ASAN )
+    if ( !std::is_constant_evaluated() )
+        __asan_unpoison_memory_region( p, s );
+#endif
+}
+
+
+template < typename T, typename = void >
+struct element_type_trait
+{
+    using type = std::remove_pointer_t< T >;
+};
+
+template < typename T >
+struct element_type_trait< T, std::void_t< typename T::element_type > >
+{
+    using type = typename T::element_type;
+};
+
+// Fancy pointers without a nested element_type, e.g. Ptr<T, Args...>
+template < typename T >
+    requires( !std::is_pointer_v< T > && !requires { typename T::element_type; }
+              && requires { typename std::pointer_traits< T >::element_type; } )
+struct element_type_trait< T, void >
+{
+    using type = typename std::pointer_traits< T >::element_type;
+};
+
+template < typename T >
+using element_type_t = typename element_type_trait< T >::type;
+
+/**
+ * @brief Concept: P is a fancy pointer (e.g. an offset pointer into a shared
+ *        memory segment): a nullable class type that std::pointer_traits can
+ *        rebuild from a reference and std::to_address can decode.
+ */
+template < typename P >
+concept fancy_pointer = std::is_class_v< P >
+                     && requires( const P& p, typename std::pointer_traits< P >::element_type& r ) {
+                            { std::pointer_traits< P >::pointer_to( r ) } -> std::convertible_to< P >;
+                            std::to_address( p );
+                            p == nullptr;
+                        };
+
+/**
+ * @brief Decodes the raw address held by a raw, smart or fancy pointer.
+ *
+ * Smart pointers are decoded through get(), fancy pointers through
+ * std::to_address. A get() that returns a fancy pointer (e.g. std::unique_ptr
+ * with an allocator-provided pointer type) is decoded recursively.
+ */
+template < typename P >
+constexpr auto* to_address( const P& p ) noexcept
+{
+    if constexpr ( std::is_pointer_v< P > )
+        return p;
+    else if constexpr ( requires { p.get(); } )
+        return detail::to_address( p.get() );
+    else
+        return std::to_address( p );
+}
+
+/**
+ * @brief Concept: pointer type is copy-constructible and copy-assignable.
+ * True for raw pointers and std::shared_ptr, false for std::unique_ptr.
+ */
+template < typename T >
+concept copyable_pointer = std::copy_constructible< T > && std::is_copy_assignable_v< T >;
+
+template < typename T >
+constexpr void assume_nonnull( const T& ptr ) noexcept
+{
+    [[maybe_unused]] const bool is_not_null = ( ptr != nullptr );
+    assert( is_not_null && "nova::detail::assume_nonnull: pointer cannot be null" );
+    NOVA_ASSUME( is_not_null );
+}
+
+} // namespace detail
+
+// =============================================================================
+// contract policies
+// =============================================================================
+
+/**
+ * @brief Describes a violated non-null / non-empty precondition.
+ */
+struct contract_violation
+{
+    const char*          what;  ///< e.g. "nova::non_null: pointer cannot be null"
+    std::source_location where; ///< The construction site that passed the null
+};
+
+using contract_violation_handler = void ( * )( const contract_violation& );
+
+/**
+ * @brief Thrown by contract_throw on a null pointer or empty callable.
+ */
+class contract_violation_error : public std::logic_error
+{
+public:
+    explicit contract_violation_error( const contract_violation& v ) :
+        std::logic_error( v.what ),
+        where_( v.where )
+    {}
+
+    const std::source_location& where() const noexcept
+    {
+        return where_;
+    }
+
+private:
+    std::source_location where_;
+};
+
+namespace detail {
+
+inline std::atomic< contract_violation_handler > violation_handler { nullptr };
+
+[[noreturn]] inline void contract_abort( const contract_violation& v ) noexcept
+{
+    std::fprintf( stderr,
+                  "%s:%u: %s: %s\n",
+                  v.where.file_name(),
+                  unsigned( v.where.line() ),
+                  v.where.function_name(),
+                  v.what );
+    std::abort();
+}
+
+[[noreturn]] inline void contract_trap() noexcept
+{
+#if defined( __GNUC__ ) || defined( __clang__ )
+    __builtin_trap();
+#else
+    std::abort();
+#endif
+}
+
+// Calls the installed handler; aborts if there is none or if it returns.
+[[noreturn]] inline void contract_call_handler( const contract_violation& v )
+{
+    if ( contract_violation_handler handler = violation_handler.load( std::memory_order_acquire ) )
+        handler( v );
+    contract_abort( v );
+}
+
+[[noreturn]] inline void contract_throw( const contract_violation& v )
+{
+#if defined( __cpp_exceptions )
+    throw contract_violation_error( v );
+#else
+    contract_call_handler( v );
+#endif
+}
+
+} // namespace detail
+
+/**
+ * @brief Installs the handler called by contract_handler, returning the previous one.
+ *
+ * The handler may throw or terminate; if it returns, the program is aborted.
+ * Passing nullptr restores the default, which prints the violation and aborts.
+ */
+inline contract_violation_handler set_contract_violation_handler( contract_violation_handler handler ) noexcept
+{
+    return detail::violation_handler.exchange( handler, std::memory_order_acq_rel );
+}
+
+inline contract_violation_handler get_contract_violation_handler() noexcept
+{
+    return detail::violation_handler.load( std::memory_order_acquire );
+}
+
+/**
+ * @brief Contract policies for the construction of never-null wrappers.
+ *
+ * A policy decides what happens when a null pointer or empty callable is
+ * passed to non_null, non_null_function or non_null_move_only_function. Every
+ * policy lets the optimiser assume the invariant afterwards. All of them
+ * provide
+ *
+ *   static constexpr void check( bool ok, const char* what, const std::source_location& where );
+ *
+ * - contract_trust:   no check; a null is undefined behaviour (assume only)
+ * - contract_assert:  assert-like check in debug builds, assume with NDEBUG (the default)
+ * - contract_trap:    always checked; traps (__builtin_trap) on violation
+ * - contract_handler: always checked; calls the handler installed with
+ *                     set_contract_violation_handler
+ * - contract_throw:   always checked; throws contract_violation_error
+ */
+struct contract_trust
+{
+    static constexpr void check( bool ok, const char*, const std::source_location& ) noexcept
+    {
+        NOVA_ASSUME( ok );
+    }
+};
+
+struct contract_assert
+{
+    static constexpr void check( bool ok, const char* what, const std::source_location& where ) noexcept
+    {
+#ifndef NDEBUG
+        if ( !ok )
+            detail::contract_abort( contract_violation { what, where } );
+#else
+        (void)what;
+        (void)where;
+#endif
+        NOVA_ASSUME( ok );
+    }
+};
+
+struct contract_trap
+{
+    static constexpr void check( bool ok, const char*, const std::source_location& ) noexcept
+    {
+        if ( !ok ) [[unlikely]]
+            detail::contract_trap();
+    }
+};
+
+struct contract_handler
+{
+    static constexpr void check( bool ok, const char* what, const std::source_location& where )
+    {
+        if ( !ok ) [[unlikely]]
+            detail::contract_call_handler( contract_violation { what, where } );
+    }
+};
+
+struct contract_throw
+{
+    static constexpr void check( bool ok, const char* what, const std::source_location& where )
+    {
+        if ( !ok ) [[unlikely]]
+            detail::contract_throw( contract_violation { what, where } );
+    }
+};
+
+/**
+ * @brief Policy used by the default template arguments.
+ *
+ * Define NOVA_CONTRACT_POLICY before including this header to select it, e.g.
+ * -DNOVA_CONTRACT_POLICY=nova::contract_trap. contract_default is an alias, so
+ * the selected policy is part of every wrapper type: translation units built
+ * with different policies get distinct types rather than conflicting inline
+ * definitions.
+ */
+#ifndef NOVA_CONTRACT_POLICY
+#    define NOVA_CONTRACT_POLICY ::nova::contract_assert
+#endif
+
+using contract_default = NOVA_CONTRACT_POLICY;
+
+/**
+ * @brief Concept: P is a contract policy.
+ */
+template < typename P >
+concept contract_policy = requires( bool ok, const char* what, const std::source_location& where ) {
+    P::check( ok, what, where );
+};
+
+// =============================================================================
+// non_null
+// =============================================================================
+
+template < typename T >
+class non_null_weak_ptr;
+
+/**
+ * @brief A simple non-null wrapper for pointers and smart-pointers.
+ *
+ * @tparam T      The pointer type (e.g., T*, std::unique_ptr<T>, std::shared_ptr<T>, or
+ *                a std::pointer_traits-conforming fancy pointer such as an offset pointer).
+ * @tparam Policy The contract policy applied on construction (see contract_default).
+ */
+template < typename T, contract_policy Policy = contract_default >
+class non_null
+{
+public:
+    using element_type  = detail::element_type_t< T >;
+    using pointer       = element_type*;
+    using contract_type = Policy;
+
+    template < typename, contract_policy >
+    friend class non_null;
+
+    static_assert( std::is_constructible_v< bool, T >,
+                   "T must be contextually convertible to bool (to check for null)" );
+
+    /**
+     * @brief Constructs a non_null wrapper from a pointer.
+     * @param p The pointer to wrap. Must not be null.
+     */
+    template < typename U >
+    constexpr explicit non_null( U&& p, const std::source_location& where = std::source_location::current() )
+        requires std::is_convertible_v< U, T >
+        :
+        ptr_( std::forward< U >( p ) )
+    {
+        Policy::check( ptr_ != nullptr, "nova::non_null: pointer cannot be null", where );
+        detail::nova_count_construction();
+    }
+
+    /**
+     * @brief Constructs a non_null wrapper from another compatible non_null
+     *        wrapper, possibly with a different contract policy.
+     * @param other The non_null wrapper to copy from.
+     */
+    template < typename U, typename Q >
+    constexpr non_null( const non_null< U, Q >& other )
+        requires std::is_convertible_v< U, T >
+        :
+        ptr_( other.underlying() )
+    {
+        detail::assume_nonnull( ptr_ );
+        detail::nova_count_copy();
+    }
+
+    // Move operations are selectively enabled:
+    // - For copyable pointers (raw pointers, shared_ptr): move allowed
+    // - For move-only pointers (unique_ptr): move deleted; use take() instead
+    // This prevents accidental moves of move-only types while enabling efficient
+    // moves of copyable types.
+#if NOVA_INSTRUMENTATION
+    constexpr non_null( const non_null& other ) noexcept( std::is_nothrow_copy_constructible_v< T > )
+        requires detail::copyable_pointer< T >
+        :
+        ptr_( other.ptr_ )
+    {
+        detail::nova_count_copy();
+    }
+#else
+    non_null( const non_null& ) = default;
+#endif
+    constexpr non_null& operator=( const non_null& other ) noexcept
+        requires detail::copyable_pointer< T >
+    {
+        // If this object was previously poisoned by take(), ensure we can write
+        // into ptr_ without ASAN reporting a write to poisoned memory.
+        detail::nova_asan_unpoison( &ptr_, sizeof( ptr_ ) );
+        ptr_ = other.ptr_;
+        detail::nova_count_copy();
+        return *this;
+    }
+
+    /**
+     * @brief Move constructor, enabled only for copyable pointer types.
+     * Raw pointers and std::shared_ptr support moves; std::unique_ptr does not.
+     */
+    constexpr non_null( non_null&& other ) noexcept
+        requires detail::copyable_pointer< T >
+        :
+        ptr_( std::move( other.ptr_ ) )
+    {}
+
+    // constexpr so that non_null is a literal type (make_static_non_null).
+    constexpr ~non_null()
+    {
+        detail::nova_asan_unpoison( &ptr_, sizeof( ptr_ ) );
+    }
+
+    /**
+     * @brief Move assignment, enabled only for copyable pointer types.
+     * Raw pointers and std::shared_ptr support moves; std::unique_ptr does not.
+     */
+    constexpr non_null& operator=( non_null&& other ) noexcept
+        requires detail::copyable_pointer< T >
+    {
+        detail::nova_asan_unpoison( &ptr_, sizeof( ptr_ ) );
+        ptr_ = std::move( other.ptr_ );
+        return *this;
+    }
+
+    // Deleted move operations for move-only pointer types
+    non_null( non_null&& )            = delete;
+    non_null& operator=( non_null&& ) = delete;
+
+    // Disable null construction and null assignment
+    non_null( std::nullptr_t )            = delete;
+    non_null& operator=( std::nullptr_t ) = delete;
+
+    /**
+     * @brief Explicitly extracts the underlying pointer, consuming the non_null wrapper.
+     *
+     * After this call the non_null object is in a moved-from state and must not be used
+     * (it will be destroyed normally, but accessing it is undefined behaviour).
+     *
+     * This is the only way to transfer ownership out of a non_null<std::unique_ptr>.
+     * For copyable pointer types the result can be re-wrapped immediately:
+     *   auto nn2 = non_null( take( std::move(nn1) ) );
+     */
+    friend constexpr T NOVA_NONNULL_NONTRIVIAL take( non_null&& nn ) noexcept
+#if defined( __clang__ ) && ( __clang_major__ >= 20 )
+        NOVA_RETURNS_NONNULL
+#endif
+    {
+        T tmp = std::move( nn.ptr_ );
+        detail::assume_nonnull( tmp );
+        // Poison the source wrapper storage so accidental use-after-take
+        // triggers ASAN in instrumented builds.
+        detail::nova_asan_poison( &nn.ptr_, sizeof( nn.ptr_ ) );
+        detail::nova_count_take();
+        return tmp;
+    }
+
+    /**
+     * @brief Swaps the managed pointers of two non_null objects.
+     * Both objects remain non-null after the swap.
+     */
+    constexpr void swap( non_null& other ) noexcept
+    {
+        // Unpoison both sides before swapping so the swap operation can write
+        // into the underlying storage safely under ASAN.
+        detail::nova_asan_unpoison( &ptr_, sizeof( ptr_ ) );
+        detail::nova_asan_unpoison( &other.ptr_, sizeof( other.ptr_ ) );
+        using std::swap;
+        swap( ptr_, other.ptr_ );
+    }
+
+    /**
+     * @brief Returns the underlying raw pointer.
+     * Semantically equivalent to std::shared_ptr::get().
+     * @return The raw pointer.
+     */
+    constexpr pointer NOVA_NONNULL get() const noexcept NOVA_RETURNS_NONNULL
+    {
+        detail::assume_nonnull( ptr_ );
+        // Fancy pointers encode the address; the hint must reach the decoded value.
+        pointer p = detail::to_address( ptr_ );
+        detail::assume_nonnull( p );
+        return p;
+    }
+
+    /**
+     * @brief Returns the underlying pointer object (e.g., T* or smart pointer).
+     * @return A const reference to the underlying pointer object.
+     */
+    constexpr const T& underlying() const& noexcept
+#if defined( __clang__ ) && ( __clang_major__ >= 20 )
+        NOVA_RETURNS_NONNULL
+#endif
+    {
+        detail::assume_nonnull( ptr_ );
+        return ptr_;
+    }
+
+    T underlying() && noexcept = delete;
+
+    /**
+     * @brief Returns a non-owning non_null<pointer> to the pointee, without
+     *        touching a reference count.
+     *
+     * For owning and fancy pointers the result is lifetimebound: it must not
+     * outlive this wrapper, and borrowing from a temporary is deleted. For raw
+     * pointers borrow() is a plain copy.
+     */
+    constexpr non_null< pointer, Policy > borrow() const& noexcept NOVA_LIFETIMEBOUND
+        requires( !std::is_pointer_v< T > )
+    {
+        return non_null< pointer, Policy >( get() );
+    }
+
+    constexpr non_null< pointer, Policy > borrow() const& noexcept
+        requires std::is_pointer_v< T >
+    {
+        return *this;
+    }
+
+    non_null< pointer, Policy > borrow() && noexcept
+        requires( !std::is_pointer_v< T > )
+    = delete;
+
+    /**
+     * @brief Accesses the members of the object pointed to.
+     * @return The underlying raw pointer.
+     */
+    constexpr pointer NOVA_NONNULL operator->() const noexcept NOVA_RETURNS_NONNULL
+    {
+        return get();
+    }
+
+    /**
+     * @brief Dereferences the underlying pointer.
+     * @return A reference to the pointed-to object.
+     */
+    constexpr decltype( auto ) operator*() const noexcept
+    {
+        detail::assume_nonnull( ptr_ );
+        return *ptr_;
+    }
+
+    /**
+     * @brief Accesses an element of the pointed-to array.
+     * Available only for array smart pointers (std::unique_ptr<T[]>, std::shared_ptr<T[]>).
+     */
+    constexpr decltype( auto ) operator[]( std::size_t i ) const noexcept
+        requires( !std::is_pointer_v< T > ) && requires( const T& p ) { p[ i ]; }
+    {
+        return get()[ i ];
+    }
+
+    /**
+     * @brief Explicitly converts the non_null wrapper to its underlying pointer type.
+     * @return A const reference to the underlying pointer object.
+     */
+    constexpr explicit operator const T&() const& noexcept
+#if defined( __clang__ ) && ( __clang_major__ >= 20 )
+        NOVA_RETURNS_NONNULL
+#endif
+    {
+        detail::assume_nonnull( ptr_ );
+        return ptr_;
+    }
+
+    /**
+     * @brief Always returns true as non_null objects are guaranteed to be non-null.
+     * @return true.
+     */
+    constexpr explicit operator bool() const noexcept
+    {
+        return true;
+    }
+
+    // --- unique_ptr-specific observers (concept-gated) ----------------------------
+
+    /**
+     * @brief Returns the deleter associated with the managed pointer.
+     * Available only when T provides get_deleter() (e.g. std::unique_ptr).
+     */
+    constexpr decltype( auto ) get_deleter() noexcept
+        requires requires { std::declval< T& >().get_deleter(); }
+    {
+        return ptr_.get_deleter();
+    }
+
+    constexpr decltype( auto ) get_deleter() const noexcept
+        requires requires { std::declval< const T& >().get_deleter(); }
+    {
+        return ptr_.get_deleter();
+    }
+
+    // --- shared_ptr-specific observers (concept-gated) ----------------------------
+
+    /**
+     * @brief Returns the number of shared_ptr instances sharing ownership.
+     * Available only when T is std::shared_ptr.
+     */
+    constexpr long use_count() const noexcept
+        requires requires { std::declval< const T& >().use_count(); }
+    {
+        return ptr_.use_count();
+    }
+
+    /**
+     * @brief Owner-based ordering; consistent with std::owner_less.
+     * Available only when T is std::shared_ptr.
+     */
+    template < typename Y, typename Q >
+    constexpr bool owner_before( const non_null< std::shared_ptr< Y >, Q >& other ) const noexcept
+        requires requires { std::declval< const T& >().owner_before( std::declval< const std::shared_ptr< Y >& >() ); }
+    {
+        return ptr_.owner_before( other.underlying() );
+    }
+
+    template < typename Y >
+    constexpr bool owner_before( const std::shared_ptr< Y >& other ) const noexcept
+        requires requires { std::declval< const T& >().owner_before( std::declval< const std::shared_ptr< Y >& >() ); }
+    {
+        return ptr_.owner_before( other );
+    }
+
+    template < typename Y >
+    constexpr bool owner_before( const std::weak_ptr< Y >& other ) const noexcept
+        requires requires { std::declval< const T& >().owner_before( std::declval< const std::weak_ptr< Y >& >() ); }
+    {
+        return ptr_.owner_before( other );
+    }
+
+    template < typename Y >
+    constexpr bool owner_before( const non_null_weak_ptr< Y >& other ) const noexcept
+        requires requires { std::declval< const T& >().owner_before( std::declval< const std::weak_ptr< Y >& >() ); }
+    {
+        return ptr_.owner_before( other.underlying() );
+    }
+
+    /**
+     * @brief Owner-based hashing (C++26).
+     * Available only when T is std::shared_ptr.
+     */
+    constexpr std::size_t owner_hash() const noexcept
+        requires requires { std::declval< const T& >().owner_hash(); }
+    {
+        return ptr_.owner_hash();
+    }
+
+    /**
+     * @brief Owner-based equal comparison (C++26).
+     * Available only when T is std::shared_ptr.
+     */
+    template < typename Y, typename Q >
+    constexpr bool owner_equal( const non_null< std::shared_ptr< Y >, Q >& other ) const noexcept
+        requires requires { std::declval< const T& >().owner_equal( std::declval< const std::shared_ptr< Y >& >() ); }
+    {
+        return ptr_.owner_equal( other.underlying() );
+    }
+
+    template < typename Y >
+    constexpr bool owner_equal( const std::shared_ptr< Y >& other ) const noexcept
+        requires requires { std::declval< const T& >().owner_equal( std::declval< const std::shared_ptr< Y >& >() ); }
+    {
+        return ptr_.owner_equal( other );
+    }
+
+    template < typename Y >
+    constexpr bool owner_equal( const std::weak_ptr< Y >& other ) const noexcept
+        requires requires { std::declval< const T& >().owner_equal( std::declval< const std::weak_ptr< Y >& >() ); }
+    {
+        return ptr_.owner_equal( other );
+    }
+
+    template < typename Y >
+    constexpr bool owner_equal( const non_null_weak_ptr< Y >& other ) const noexcept
+        requires requires { std::declval< const T& >().owner_equal( std::declval< const std::weak_ptr< Y >& >() ); }
+    {
+        return ptr_.owner_equal( other.underlying() );
+    }
+
+    /**
+     * @brief Compares two non_null wrappers for equality.
+     */
+    template < typename U, typename Q >
+    friend constexpr bool operator==( const non_null& lhs, const non_null< U, Q >& rhs )
+    {
+        return lhs.get() == rhs.get();
+    }
+
+    /**
+     * @brief Performs a three-way comparison between two non_null wrappers.
+     */
+    template < typename U, typename Q >
+    friend constexpr auto operator<=>( const non_null& lhs, const non_null< U, Q >& rhs )
+    {
+        return lhs.get() <=> rhs.get();
+    }
+
+    /**
+     * @brief Compares a non_null wrapper with a compatible pointer for equality.
+     */
+    template < typename U >
+    friend constexpr bool operator==( const non_null& lhs, const U& rhs )
+    {
+        if constexpr ( std::is_same_v< U, std::nullptr_t > )
+            return false;
+        else
+            return lhs.get() == rhs;
+    }
+
+    /**
+     * @brief Performs a three-way comparison between a non_null wrapper and a compatible pointer.
+     */
+    template < typename U >
+    friend constexpr auto operator<=>( const non_null& lhs, const U& rhs )
+    {
+        return lhs.get() <=> rhs;
+    }
+
+private:
+    T NOVA_NONNULL_NONTRIVIAL ptr_;
+};
+
+template < typename T >
+non_null( T* NOVA_NONNULL ) -> non_null< T* >;
+
+template < typename T, typename D >
+non_null( std::unique_ptr< T, D > NOVA_NONNULL_NONTRIVIAL ) -> non_null< std::unique_ptr< T, D > >;
+
+template < typename T >
+non_null( std::shared_ptr< T > NOVA_NONNULL_NONTRIVIAL ) -> non_null< std::shared_ptr< T > >;
+
+template < typename T, typename P >
+non_null( non_null< T, P > ) -> non_null< T, P >;
+
+template < detail::fancy_pointer P >
+non_null( P ) -> non_null< P >;
+
+/**
+ * @brief Swaps the contents of two non_null objects (found via ADL).
+ */
+template < typename T, typename P >
+void swap( non_null< T, P >& lhs, non_null< T, P >& rhs ) noexcept
+{
+    lhs.swap( rhs );
+}
+
+template < typename T >
+using non_null_unique_ptr = non_null< std::unique_ptr< T > >;
+
+template < typename T >
+using non_null_shared_ptr = non_null< std::shared_ptr< T > >;
+
+/**
+ * @brief A borrowed non-null pointer, the parameter type for functions that
+ *        only use the pointee. Owning wrappers convert with borrow().
+ */
+template < typename T >
+using non_null_borrow = non_null< T* >;
+
+/**
+ * @brief Factory function that creates a non_null<std::unique_ptr<T>>.
+ * Similar to std::make_unique, but returns a non-null wrapper.
+ * @tparam T The type to construct.
+ * @tparam Args The argument types for T's constructor.
+ * @param args Arguments to forward to T's constructor.
+ * @return A non_null<std::unique_ptr<T>> wrapping the newly created object.
+ */
+template < typename T, typename... Args >
+constexpr non_null< std::unique_ptr< T > > make_non_null_unique( Args&&... args )
+{
+    return non_null( std::make_unique< T >( std::forward< Args >( args )... ) );
+}
+
+/**
+ * @brief Factory function that creates a non_null<std::shared_ptr<T>>.
+ * Similar to std::make_shared, but returns a non-null wrapper.
+ * @tparam T The type to construct.
+ * @tparam Args The argument types for T's constructor.
+ * @param args Arguments to forward to T's constructor.
+ * @return A non_null<std::shared_ptr<T>> wrapping the newly created object.
+ */
+template < typename T, typename... Args >
+inline non_null< std::shared_ptr< T > > make_non_null_shared( Args&&... args )
+{
+    return non_null( std::make_shared< T >( std::forward< Args >( args )... ) );
+}
+
+// =============================================================================
+// compile-time non_null for static objects
+// =============================================================================
+
+namespace detail {
+
+// Not constexpr: reaching it in constant evaluation is the diagnostic.
+inline void static_non_null_argument_is_null() noexcept
+{}
+
+} // namespace detail
+
+/**
+ * @brief Creates a non_null<T*> from an address known at compile time.
+ *
+ * The null check happens during constant evaluation, so the result can
+ * initialise a constinit variable without any start-up code:
+ *
+ *   constinit nova::non_null< Registry* > registry = nova::make_static_non_null( &global_registry );
+ *
+ * Passing a null pointer is a compile error.
+ */
+template < contract_policy Policy = contract_default, typename T >
+consteval non_null< T*, Policy > make_static_non_null( T* p ) noexcept
+{
+    if ( p == nullptr )
+        detail::static_non_null_argument_is_null();
+    return non_null< T*, Policy >( p );
+}
+
+/**
+ * @brief A stateless, never-null handle to the object at address Ptr.
+ *
+ * Non-nullness is a constraint on the template argument, so it is proven at
+ * compile time. The handle stores nothing: get() returns the constant
+ * address, and the handle is empty (zero-size as a [[no_unique_address]]
+ * member). It converts to non_null<U*> for APIs that take the runtime wrapper.
+ *
+ *   static Logger           logger;
+ *   nova::non_null_of< &logger > log;
+ *   log->write( "..." );
+ *
+ * @tparam Ptr The address of an object or function with static storage duration.
+ */
+template < auto* Ptr >
+    requires( Ptr != nullptr )
+class non_null_of
+{
+public:
+    using pointer      = decltype( Ptr );
+    using element_type = std::remove_pointer_t< pointer >;
+
+    static constexpr pointer NOVA_NONNULL get() noexcept NOVA_RETURNS_NONNULL
+    {
+        return Ptr;
+    }
+
+    constexpr pointer NOVA_NONNULL operator->() const noexcept NOVA_RETURNS_NONNULL
+    {
+        return Ptr;
+    }
+
+    constexpr decltype( auto ) operator*() const noexcept
+    {
+        return *Ptr;
+    }
+
+    /**
+     * @brief Always returns true, the address is non-null by construction.
+     */
+    constexpr explicit operator bool() const noexcept
+    {
+        return true;
+    }
+
+    /**
+     * @brief Converts to a runtime non_null wrapper; the check folds away.
+     */
+    template < typename U, typename Q >
+        requires std::is_convertible_v< pointer, U >
+    constexpr operator non_null< U, Q >() const noexcept
+    {
+        return non_null< U, Q >( Ptr );
+    }
+
+    template < auto* Other >
+    friend constexpr bool operator==( non_null_of, non_null_of< Other > ) noexcept
+    {
+        return Ptr == Other;
+    }
+
+    template < typename U, typename Q >
+    friend constexpr bool operator==( non_null_of, const non_null< U, Q >& rhs ) noexcept
+    {
+        return Ptr == rhs.get();
+    }
+};
+
+// =============================================================================
+// trivial relocation
+// =============================================================================
+
+/**
+ * @brief Trait: T can be relocated (move-constructed into new storage and the
+ *        source destroyed) by copying its object representation.
+ *
+ * True for trivially copyable types, std::unique_ptr with a trivially
+ * relocatable deleter, std::shared_ptr / std::weak_ptr, and the nova wrappers
+ * around such pointers. May be specialised for user types.
+ */
+template < typename T >
+struct is_trivially_relocatable : std::is_trivially_copyable< T >
+{};
+
+template < typename T, typename D >
+struct is_trivially_relocatable< std::unique_ptr< T, D > > : is_trivially_relocatable< D >
+{};
+
+template < typename T >
+struct is_trivially_relocatable< std::shared_ptr< T > > : std::true_type
+{};
+
+template < typename T >
+struct is_trivially_relocatable< std::weak_ptr< T > > : std::true_type
+{};
+
+template < typename T, typename P >
+struct is_trivially_relocatable< non_null< T, P > > : is_trivially_relocatable< T >
+{};
+
+template < typename T >
+inline constexpr bool is_trivially_relocatable_v = is_trivially_relocatable< T >::value;
+
+} // namespace nova
+
+#include <nova/non_null/detail/epilogue.hpp>
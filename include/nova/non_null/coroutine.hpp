@@ -0,0 +1,383 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2026 Tim Blechmann
+
+#pragma once
+
+#include <nova/non_null/functional.hpp>
+
+#include <compare>
+#include <coroutine>
+
+#include <nova/non_null/detail/prologue.hpp>
+
+namespace nova {
+
+// =============================================================================
+// non_null_coroutine_handle
+// =============================================================================
+
+/**
+ * @brief A never-null std::coroutine_handle<Promise>.
+ *
+ * One word and trivially copyable. resume(), done() and destroy() perform no
+ * check, and a null test on get() folds away. Converts implicitly to the std
+ * handle, so it can be returned from await_suspend for symmetric transfer.
+ *
+ * @tparam Promise The promise type, or void for a type-erased handle.
+ * @tparam Policy  The contract policy checking construction from a std handle.
+ */
+template < typename Promise = void, contract_policy Policy = contract_default >
+class non_null_coroutine_handle
+{
+    struct trusted_t
+    {};
+
+public:
+    using handle_type   = std::coroutine_handle< Promise >;
+    using promise_type  = Promise;
+    using contract_type = Policy;
+
+    /**
+     * @brief Wraps a coroutine handle.
+     * @param h The handle to wrap. Must not be null (checked by Policy).
+     */
+    constexpr explicit non_null_coroutine_handle(
+        handle_type h, const std::source_location& where = std::source_location::current() ) :
+        h_( h )
+    {
+        Policy::check( h_.address() != nullptr, "nova::non_null_coroutine_handle: handle cannot be null", where );
+        detail::nova_count_construction();
+    }
+
+    /**
+     * @brief Converts from a handle with a compatible promise type, e.g. a typed
+     *        handle to the type-erased non_null_coroutine_handle<>.
+     */
+    template < typename P, typename Q >
+        requires( !std::is_same_v< non_null_coroutine_handle< P, Q >, non_null_coroutine_handle > )
+                && std::is_convertible_v< std::coroutine_handle< P >, handle_type >
+    constexpr non_null_coroutine_handle( const non_null_coroutine_handle< P, Q >& other ) noexcept :
+        h_( other.get() )
+    {}
+
+    non_null_coroutine_handle( const non_null_coroutine_handle& )            = default;
+    non_null_coroutine_handle& operator=( const non_null_coroutine_handle& ) = default;
+
+    // Prevent null assignment / null construction
+    non_null_coroutine_handle( std::nullptr_t )            = delete;
+    non_null_coroutine_handle& operator=( std::nullptr_t ) = delete;
+
+    /**
+     * @brief Returns the handle of the coroutine whose promise is p. No check
+     *        is needed: a promise always belongs to a coroutine frame.
+     */
+    template < typename P = Promise >
+        requires( !std::is_void_v< P > && requires( P& p ) { handle_type::from_promise( p ); } )
+    static non_null_coroutine_handle from_promise( P& p ) noexcept
+    {
+        return non_null_coroutine_handle( trusted_t {}, handle_type::from_promise( p ) );
+    }
+
+    /**
+     * @brief Returns the handle of std::noop_coroutine(), which does nothing when
+     *        resumed: the "no continuation" value of an awaiter.
+     */
+    static non_null_coroutine_handle noop() noexcept
+        requires std::is_convertible_v< std::noop_coroutine_handle, handle_type >
+    {
+        return non_null_coroutine_handle( trusted_t {}, std::noop_coroutine() );
+    }
+
+    /**
+     * @brief Returns the std handle.
+     */
+    constexpr handle_type get() const noexcept
+    {
+        detail::assume_nonnull( h_.address() );
+        return h_;
+    }
+
+    /**
+     * @brief Converts to the std handle, or to a std handle of a compatible
+     *        promise type such as std::coroutine_handle<>.
+     */
+    template < typename P >
+        requires std::is_convertible_v< handle_type, std::coroutine_handle< P > >
+    constexpr operator std::coroutine_handle< P >() const noexcept
+    {
+        return get();
+    }
+
+    /**
+     * @brief Returns the address of the coroutine frame.
+     */
+    constexpr void* NOVA_NONNULL address() const noexcept NOVA_RETURNS_NONNULL
+    {
+        return get().address();
+    }
+
+    /**
+     * @brief Resumes the coroutine. No null check is performed.
+     */
+    void resume() const
+    {
+        get().resume();
+    }
+
+    void operator()() const
+    {
+        get().resume();
+    }
+
+    bool done() const noexcept
+    {
+        return get().done();
+    }
+
+    void destroy() const
+    {
+        get().destroy();
+    }
+
+    /**
+     * @brief Returns the promise of the coroutine.
+     */
+    template < typename P = Promise >
+        requires( !std::is_void_v< P > )
+    P& promise() const noexcept
+    {
+        return get().promise();
+    }
+
+    /**
+     * @brief Always returns true; the handle is guaranteed non-null.
+     */
+    constexpr explicit operator bool() const noexcept
+    {
+        return true;
+    }
+
+    /**
+     * @brief Swaps the handles. Both objects remain non-null.
+     */
+    constexpr void swap( non_null_coroutine_handle& other ) noexcept
+    {
+        std::swap( h_, other.h_ );
+    }
+
+    constexpr bool operator==( const non_null_coroutine_handle& other ) const noexcept
+    {
+        return h_ == other.h_;
+    }
+
+    constexpr std::strong_ordering operator<=>( const non_null_coroutine_handle& other ) const noexcept
+    {
+        return h_ <=> other.h_;
+    }
+
+private:
+    constexpr non_null_coroutine_handle( trusted_t, handle_type h ) noexcept :
+        h_( h )
+    {
+        detail::assume_nonnull( h_.address() );
+    }
+
+    handle_type h_;
+};
+
+/**
+ * @brief Deduction guide: deduce the promise type from a std handle.
+ */
+template < typename Promise >
+non_null_coroutine_handle( std::coroutine_handle< Promise > ) -> non_null_coroutine_handle< Promise >;
+
+/**
+ * @brief ADL swap for non_null_coroutine_handle.
+ */
+template < typename Promise, typename P >
+constexpr void swap( non_null_coroutine_handle< Promise, P >& lhs,
+                     non_null_coroutine_handle< Promise, P >& rhs ) noexcept
+{
+    lhs.swap( rhs );
+}
+
+#if defined( __cpp_lib_move_only_function ) && __cpp_lib_move_only_function >= 202110L
+
+// =============================================================================
+// non_null_continuation  (C++23)
+// =============================================================================
+
+/**
+ * @brief A never-empty continuation for coroutine-based executors: either a
+ *        coroutine handle or a move-only void() callable.
+ *
+ * resume() is a single indirect call through the stored resume function, with
+ * no null or discriminator test. A continuation holding a handle needs no
+ * allocation and no type erasure; a callable is stored inline in a
+ * std::move_only_function next to the resume function rather than boxed on the
+ * heap.
+ *
+ * Moving leaves the source holding non_null_coroutine_handle<>::noop(), so a
+ * moved-from continuation is still safe to resume.
+ */
+class non_null_continuation
+{
+public:
+    using function_type = std::move_only_function< void() >;
+
+    /**
+     * @brief Continues with the coroutine h.
+     */
+    template < typename Promise, typename Policy >
+    non_null_continuation( const non_null_coroutine_handle< Promise, Policy >& h ) noexcept :
+        resume_( &resume_coroutine ),
+        handle_( h )
+    {}
+
+    /**
+     * @brief Continues by calling fn, taking it over.
+     */
+    template < typename Policy >
+    non_null_continuation( non_null_move_only_function< void(), Policy >&& fn ) noexcept :
+        resume_( &resume_function )
+    {
+        ::new ( static_cast< void* >( &fn_ ) ) function_type( take( std::move( fn ) ) );
+    }
+
+    non_null_continuation( non_null_continuation&& other ) noexcept :
+        resume_( other.resume_ )
+    {
+        adopt( other );
+    }
+
+    non_null_continuation& operator=( non_null_continuation&& other ) noexcept
+    {
+        if ( this != &other ) {
+            destroy();
+            resume_ = other.resume_;
+            adopt( other );
+        }
+        return *this;
+    }
+
+    non_null_continuation( const non_null_continuation& )            = delete;
+    non_null_continuation& operator=( const non_null_continuation& ) = delete;
+
+    // Prevent null assignment / null construction
+    non_null_continuation( std::nullptr_t )            = delete;
+    non_null_continuation& operator=( std::nullptr_t ) = delete;
+
+    ~non_null_continuation()
+    {
+        destroy();
+    }
+
+    /**
+     * @brief Resumes the coroutine or calls the callable. No check is performed.
+     */
+    void resume()
+    {
+        resume_( *this );
+    }
+
+    void operator()()
+    {
+        resume_( *this );
+    }
+
+    /**
+     * @brief Returns the handle to resume by symmetric transfer from
+     *        await_suspend: the stored coroutine, or, for a callable, calls it
+     *        and returns non_null_coroutine_handle<>::noop().
+     */
+    non_null_coroutine_handle<> transfer()
+    {
+        if ( holds_coroutine() )
+            return coroutine();
+        resume_function( *this );
+        return non_null_coroutine_handle<>::noop();
+    }
+
+    /**
+     * @brief True if the continuation is a coroutine handle, false if it is a
+     *        callable.
+     */
+    bool holds_coroutine() const noexcept
+    {
+        return resume_ == &resume_coroutine;
+    }
+
+    /**
+     * @brief Returns the stored coroutine. Requires holds_coroutine().
+     */
+    non_null_coroutine_handle<> coroutine() const noexcept
+    {
+        assert( holds_coroutine() && "nova::non_null_continuation::coroutine: continuation holds a callable" );
+        return handle_;
+    }
+
+    /**
+     * @brief Always returns true; the continuation is never empty.
+     */
+    constexpr explicit operator bool() const noexcept
+    {
+        return true;
+    }
+
+private:
+    static void resume_coroutine( non_null_continuation& self )
+    {
+        self.handle_.resume();
+    }
+
+    static void resume_function( non_null_continuation& self )
+    {
+        detail::assume_not_empty( self.fn_ );
+        self.fn_();
+    }
+
+    // resume_ has already been copied from other.
+    void adopt( non_null_continuation& other ) noexcept
+    {
+        if ( holds_coroutine() ) {
+            ::new ( static_cast< void* >( &handle_ ) ) non_null_coroutine_handle<>( other.handle_ );
+        } else {
+            ::new ( static_cast< void* >( &fn_ ) ) function_type( std::move( other.fn_ ) );
+            other.fn_.~function_type();
+            other.resume_ = &resume_coroutine;
+        }
+        ::new ( static_cast< void* >( &other.handle_ ) )
+            non_null_coroutine_handle<>( non_null_coroutine_handle<>::noop() );
+    }
+
+    void destroy() noexcept
+    {
+        if ( !holds_coroutine() )
+            fn_.~function_type();
+    }
+
+    void ( *resume_ )( non_null_continuation& );
+    union
+    {
+        non_null_coroutine_handle<> handle_;
+        function_type               fn_;
+    };
+};
+
+#endif // __cpp_lib_move_only_function
+
+} // namespace nova
+
+/**
+ * @brief Hashes non_null_coroutine_handle like the std handle it wraps.
+ */
+template < typename Promise, typename P >
+struct std::hash< nova::non_null_coroutine_handle< Promise, P > >
+{
+    std::size_t operator()( const nova::non_null_coroutine_handle< Promise, P >& h ) const noexcept
+    {
+        return std::hash< std::coroutine_handle< Promise > > {}( h.get() );
+    }
+};
+
+#include <nova/non_null/detail/epilogue.hpp>
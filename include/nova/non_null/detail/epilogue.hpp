@@ -0,0 +1,15 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2026 Tim Blechmann
+
+// Undefines the configuration macros of detail/prologue.hpp.
+
+#undef NOVA_ASSUME
+#undef NOVA_RETURNS_NONNULL
+#undef NOVA_NONNULL
+#undef NOVA_TRIVIAL_ABI
+#undef NOVA_LIFETIMEBOUND
+#undef NOVA_HAVE_AVX2
+#undef NOVA_HAVE_SSE2
+#ifdef NOVA_HAVE_ASAN
+#    undef NOVA_HAVE_ASAN
+#endif
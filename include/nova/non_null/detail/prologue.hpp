@@ -0,0 +1,88 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2026 Tim Blechmann
+
+// Configuration macros shared by the nova/non_null headers. Every header includes
+// this file after its own dependencies and detail/epilogue.hpp at its end, so the
+// macros never leak into user code. Deliberately without include guard.
+
+#if defined( __has_feature )
+#    if __has_feature( address_sanitizer ) && __has_include( <sanitizer/asan_interface.h> )
+#        define NOVA_HAVE_ASAN 1
+#    endif
+#endif
+#if defined( __SANITIZE_ADDRESS__ )
+#    define NOVA_HAVE_ASAN 1
+#endif
+
+#ifdef NOVA_HAVE_ASAN
+#    include <sanitizer/asan_interface.h>
+#endif
+
+// Pointer scans (find_first_null, flat table probing) use the widest of these.
+#if defined( __AVX2__ )
+#    define NOVA_HAVE_AVX2 1
+#elif defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 )
+#    define NOVA_HAVE_SSE2 1
+#endif
+
+#if defined( __has_cpp_attribute )
+#    if __has_cpp_attribute( assume )
+#        define NOVA_ASSUME( expr ) [[assume( expr )]]
+#    endif
+#endif
+
+#ifndef NOVA_ASSUME
+#    if defined( _MSC_VER )
+#        define NOVA_ASSUME( expr ) __assume( expr )
+#    elif defined( __clang__ )
+#        define NOVA_ASSUME( expr ) __builtin_assume( expr )
+#    elif defined( __GNUC__ )
+#        define NOVA_ASSUME( expr ) ( ( expr ) ? (void)0 : __builtin_unreachable() )
+#    else
+#        define NOVA_ASSUME( expr )
+#    endif
+#endif
+
+#if ( defined( __GNUC__ ) || defined( __clang__ ) ) && !( defined( __clang_major__ ) && defined( __OPTIMIZE__ ) )
+#    define NOVA_RETURNS_NONNULL __attribute__( ( returns_nonnull ) )
+#else
+#    define NOVA_RETURNS_NONNULL
+#endif
+
+#if defined( __clang__ )
+#    define NOVA_NONNULL _Nonnull
+#    if __clang_major__ >= 19
+#        define NOVA_NONNULL_NONTRIVIAL _Nonnull
+#    else
+#        define NOVA_NONNULL_NONTRIVIAL
+#    endif
+#else
+#    define NOVA_NONNULL
+#    define NOVA_NONNULL_NONTRIVIAL
+#endif
+
+#if defined( __has_cpp_attribute )
+#    if __has_cpp_attribute( clang::trivial_abi )
+#        define NOVA_TRIVIAL_ABI [[clang::trivial_abi]]
+#    endif
+#endif
+#ifndef NOVA_TRIVIAL_ABI
+#    define NOVA_TRIVIAL_ABI
+#endif
+
+// Lets the compiler diagnose a borrowed pointer that outlives its owner. GCC
+// has no equivalent attribute.
+#if defined( __has_cpp_attribute )
+#    if __has_cpp_attribute( clang::lifetimebound )
+#        define NOVA_LIFETIMEBOUND [[clang::lifetimebound]]
+#    elif __has_cpp_attribute( msvc::lifetimebound )
+#        define NOVA_LIFETIMEBOUND [[msvc::lifetimebound]]
+#    endif
+#endif
+#ifndef NOVA_LIFETIMEBOUND
+#    define NOVA_LIFETIMEBOUND
+#endif
+
+#ifndef NOVA_INSTRUMENTATION
+#    define NOVA_INSTRUMENTATION 0
+#endif
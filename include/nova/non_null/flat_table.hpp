@@ -0,0 +1,924 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2026 Tim Blechmann
+
+#pragma once
+
+#include <nova/non_null/hash.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <initializer_list>
+#include <iterator>
+
+#include <nova/non_null/detail/prologue.hpp>
+
+#if defined( NOVA_HAVE_AVX2 ) || defined( NOVA_HAVE_SSE2 )
+#    include <immintrin.h>
+#endif
+
+namespace nova {
+
+// =============================================================================
+// flat hash tables
+// =============================================================================
+
+namespace detail {
+
+struct flat_probe
+{
+    std::size_t index; // the slot holding the key, or the empty slot ending the probe
+    bool        found;
+};
+
+#if defined( NOVA_HAVE_AVX2 ) || defined( NOVA_HAVE_SSE2 )
+// Linear probe over a table of raw pointer slots, one register of slots at a
+// time: a compare against the key and one against null cover the whole group.
+// Groups are aligned, so the lanes before home are masked in the first group.
+inline flat_probe probe_pointer_groups( const void*        slots,
+                                        const void*        key,
+                                        std::size_t        home,
+                                        std::size_t        mask ) noexcept
+{
+    const char*     bytes = static_cast< const char* >( slots );
+    const long long bits  = static_cast< long long >( reinterpret_cast< std::uintptr_t >( key ) );
+#    if defined( NOVA_HAVE_AVX2 )
+    constexpr std::size_t lanes  = 32 / sizeof( void* ); // slots per group
+    const __m256i         zero   = _mm256_setzero_si256();
+    const __m256i         needle = sizeof( void* ) == 8 ? _mm256_set1_epi64x( bits ) : _mm256_set1_epi32( int( bits ) );
+    auto                  match  = [ & ]( std::size_t at, unsigned& empty ) {
+        const __m256i v = _mm256_loadu_si256( reinterpret_cast< const __m256i* >( bytes + at * sizeof( void* ) ) );
+        if constexpr ( sizeof( void* ) == 8 ) {
+            empty = unsigned( _mm256_movemask_pd( _mm256_castsi256_pd( _mm256_cmpeq_epi64( v, zero ) ) ) );
+            return unsigned( _mm256_movemask_pd( _mm256_castsi256_pd( _mm256_cmpeq_epi64( v, needle ) ) ) );
+        } else {
+            empty = unsigned( _mm256_movemask_ps( _mm256_castsi256_ps( _mm256_cmpeq_epi32( v, zero ) ) ) );
+            return unsigned( _mm256_movemask_ps( _mm256_castsi256_ps( _mm256_cmpeq_epi32( v, needle ) ) ) );
+        }
+    };
+#    else
+    constexpr std::size_t lanes  = 16 / sizeof( void* );
+    const __m128i         zero   = _mm_setzero_si128();
+    const __m128i         needle = sizeof( void* ) == 8 ? _mm_set1_epi64x( bits ) : _mm_set1_epi32( int( bits ) );
+    auto                  match  = [ & ]( std::size_t at, unsigned& empty ) {
+        const __m128i v = _mm_loadu_si128( reinterpret_cast< const __m128i* >( bytes + at * sizeof( void* ) ) );
+        if constexpr ( sizeof( void* ) == 8 ) {
+            // SSE2 has no 64-bit compare: a slot matches if both halves do.
+            const __m128i e  = _mm_cmpeq_epi32( v, zero );
+            const __m128i k  = _mm_cmpeq_epi32( v, needle );
+            const __m128i e2 = _mm_and_si128( e, _mm_shuffle_epi32( e, _MM_SHUFFLE( 2, 3, 0, 1 ) ) );
+            const __m128i k2 = _mm_and_si128( k, _mm_shuffle_epi32( k, _MM_SHUFFLE( 2, 3, 0, 1 ) ) );
+            empty            = unsigned( _mm_movemask_pd( _mm_castsi128_pd( e2 ) ) );
+            return unsigned( _mm_movemask_pd( _mm_castsi128_pd( k2 ) ) );
+        } else {
+            empty = unsigned( _mm_movemask_ps( _mm_castsi128_ps( _mm_cmpeq_epi32( v, zero ) ) ) );
+            return unsigned( _mm_movemask_ps( _mm_castsi128_ps( _mm_cmpeq_epi32( v, needle ) ) ) );
+        }
+    };
+#    endif
+    constexpr unsigned all   = ( 1u << lanes ) - 1;
+    std::size_t        group = home & ~( lanes - 1 );
+    unsigned           valid = all & ~( ( 1u << ( home - group ) ) - 1 );
+    for ( ;; ) {
+        unsigned       empty;
+        const unsigned found = match( group, empty );
+        const unsigned hit   = ( found | empty ) & valid;
+        if ( hit != 0 ) {
+            const int lane = std::countr_zero( hit );
+            return { group + std::size_t( lane ), ( ( found >> lane ) & 1u ) != 0 };
+        }
+        group = ( group + lanes ) & mask;
+        valid = all;
+    }
+}
+#endif
+
+/**
+ * @brief Open-addressing hash table over optional_non_null<P> slots, shared by
+ *        non_null_flat_set and non_null_flat_map.
+ *
+ * A key is never null, so a null slot marks an empty one: there are no control
+ * bytes and no tombstones. Lookup is linear probing, erase shifts the following
+ * entries back (backward-shift deletion). Mapped values live in a parallel
+ * array and are only constructed for occupied slots.
+ */
+template < typename P, typename Mapped, typename Hash, typename Allocator >
+class flat_table
+{
+protected:
+    static constexpr bool is_map = !std::is_void_v< Mapped >;
+
+    using slot_type      = optional_non_null< P >;
+    using element_type   = address_element_t< P >;
+    using mapped_storage = std::conditional_t< is_map, Mapped, char >;
+    using slot_alloc     = rebind_alloc_t< slot_type, Allocator >;
+    using mapped_alloc   = rebind_alloc_t< mapped_storage, Allocator >;
+    using slot_traits    = std::allocator_traits< slot_alloc >;
+    using mapped_traits  = std::allocator_traits< mapped_alloc >;
+    using alloc_traits   = std::allocator_traits< Allocator >;
+
+    static_assert( !is_map || std::is_nothrow_move_constructible_v< mapped_storage >,
+                   "nova::non_null_flat_map: the mapped type must be nothrow move constructible" );
+
+    // The smallest table holds a full SIMD group of slots.
+    static constexpr std::size_t min_capacity = 8;
+
+public:
+    using key_type       = non_null< P >;
+    using size_type      = std::size_t;
+    using hasher         = Hash;
+    using allocator_type = Allocator;
+
+    flat_table() noexcept( noexcept( Allocator() ) && noexcept( Hash() ) ) = default;
+
+    explicit flat_table( const Allocator& alloc ) noexcept :
+        alloc_( alloc )
+    {}
+
+    // Delegates first, so that ~flat_table releases what copy_from() built if
+    // copying a mapped value throws.
+    flat_table( const flat_table& other ) :
+        flat_table( other.hash_, alloc_traits::select_on_container_copy_construction( other.alloc_ ) )
+    {
+        copy_from( other );
+    }
+
+    flat_table( flat_table&& other ) noexcept :
+        hash_( other.hash_ ),
+        alloc_( std::move( other.alloc_ ) ),
+        slots_( std::exchange( other.slots_, nullptr ) ),
+        values_( std::exchange( other.values_, nullptr ) ),
+        capacity_( std::exchange( other.capacity_, 0 ) ),
+        size_( std::exchange( other.size_, 0 ) ),
+        shift_( other.shift_ )
+    {}
+
+    flat_table& operator=( const flat_table& other )
+    {
+        if ( this != &other ) {
+            flat_table tmp( other );
+            swap( tmp );
+        }
+        return *this;
+    }
+
+    flat_table& operator=( flat_table&& other ) noexcept
+    {
+        static_assert( alloc_traits::propagate_on_container_move_assignment::value
+                           || alloc_traits::is_always_equal::value,
+                       "nova::non_null_flat_set / non_null_flat_map: allocator must propagate on move assignment "
+                       "or always compare equal" );
+        if ( this != &other ) {
+            release();
+            if constexpr ( alloc_traits::propagate_on_container_move_assignment::value )
+                alloc_ = std::move( other.alloc_ );
+            hash_     = other.hash_;
+            slots_    = std::exchange( other.slots_, nullptr );
+            values_   = std::exchange( other.values_, nullptr );
+            capacity_ = std::exchange( other.capacity_, 0 );
+            size_     = std::exchange( other.size_, 0 );
+            shift_    = other.shift_;
+        }
+        return *this;
+    }
+
+    ~flat_table()
+    {
+        release();
+    }
+
+    allocator_type get_allocator() const noexcept
+    {
+        return alloc_;
+    }
+
+    hasher hash_function() const
+    {
+        return hash_;
+    }
+
+    size_type size() const noexcept
+    {
+        return size_;
+    }
+
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return size_ == 0;
+    }
+
+    /**
+     * @brief Returns the number of slots, a power of two. At most 7/8 of them
+     *        are occupied.
+     */
+    size_type capacity() const noexcept
+    {
+        return capacity_;
+    }
+
+    /**
+     * @brief Returns true if the table holds key. key may be any address-like
+     *        type (T*, non_null, a smart pointer) pointing to the element type
+     *        or to a class derived from it; a null key is never found.
+     */
+    template < address_lookup_key< element_type > K >
+    bool contains( const K& key ) const noexcept
+    {
+        return lookup( address_as< element_type >( key ) ).found;
+    }
+
+    template < address_lookup_key< element_type > K >
+    size_type count( const K& key ) const noexcept
+    {
+        return contains( key ) ? 1 : 0;
+    }
+
+    /**
+     * @brief Removes key, if present. Returns the number of removed entries.
+     */
+    template < address_lookup_key< element_type > K >
+    size_type erase( const K& key ) noexcept
+    {
+        const flat_probe probe = lookup( address_as< element_type >( key ) );
+        if ( !probe.found )
+            return 0;
+        erase_at( probe.index );
+        return 1;
+    }
+
+    /**
+     * @brief Makes room for n entries without rehashing.
+     */
+    void reserve( size_type n )
+    {
+        const size_type needed = std::bit_ceil( std::max( min_capacity, ( n * 8 + 6 ) / 7 ) );
+        if ( needed > capacity_ )
+            rehash( needed );
+    }
+
+    void clear() noexcept
+    {
+        for ( size_type i = 0; i != capacity_; ++i ) {
+            if ( slots_[ i ] ) {
+                destroy_value( i );
+                slots_[ i ].reset();
+            }
+        }
+        size_ = 0;
+    }
+
+    void swap( flat_table& other ) noexcept
+    {
+        if constexpr ( alloc_traits::propagate_on_container_swap::value ) {
+            using std::swap;
+            swap( alloc_, other.alloc_ );
+        }
+        using std::swap;
+        swap( hash_, other.hash_ );
+        swap( slots_, other.slots_ );
+        swap( values_, other.values_ );
+        swap( capacity_, other.capacity_ );
+        swap( size_, other.size_ );
+        swap( shift_, other.shift_ );
+    }
+
+protected:
+    flat_table( const Hash& hash, const Allocator& alloc ) :
+        hash_( hash ),
+        alloc_( alloc )
+    {}
+
+    size_type home( const void* addr ) const noexcept
+    {
+        // Fibonacci hashing: the high bits of the product mix in the low bits of
+        // the hash, which are constant for aligned addresses under pointer_hash.
+        return static_cast< size_type >( ( std::uint64_t( hash_( addr ) ) * 0x9E3779B97F4A7C15ull ) >> shift_ );
+    }
+
+    flat_probe lookup( const void* addr ) const noexcept
+    {
+        if ( capacity_ == 0 || addr == nullptr )
+            return { capacity_, false };
+        return probe( addr );
+    }
+
+    flat_probe probe( const void* addr ) const noexcept
+    {
+        const size_type mask  = capacity_ - 1;
+        const size_type start = home( addr );
+#if defined( NOVA_HAVE_AVX2 ) || defined( NOVA_HAVE_SSE2 )
+        if constexpr ( std::is_pointer_v< P > ) {
+            static_assert( sizeof( slot_type ) == sizeof( void* ) );
+            return probe_pointer_groups( slots_, addr, start, mask );
+        }
+#endif
+        for ( size_type i = start;; i = ( i + 1 ) & mask ) {
+            const void* slot = address_of( slots_[ i ] );
+            if ( slot == addr )
+                return { i, true };
+            if ( slot == nullptr )
+                return { i, false };
+        }
+    }
+
+    // Returns the slot of a key that is not in the table, growing it first if
+    // one more entry would exceed the maximum load factor of 7/8.
+    flat_probe prepare_insert( const void* addr, flat_probe probe_result )
+    {
+        if ( ( size_ + 1 ) * 8 > capacity_ * 7 ) {
+            rehash( capacity_ != 0 ? capacity_ * 2 : min_capacity );
+            probe_result = probe( addr );
+        }
+        return probe_result;
+    }
+
+    template < typename... Args >
+    void emplace_value( size_type index, Args&&... args )
+    {
+        mapped_alloc alloc( alloc_ );
+        mapped_traits::construct( alloc, values_ + index, std::forward< Args >( args )... );
+    }
+
+    // The value, if any, must already be constructed at index.
+    void occupy( size_type index, const key_type& key ) noexcept
+    {
+        slots_[ index ] = slot_type( key );
+        ++size_;
+    }
+
+    void erase_at( size_type hole ) noexcept
+    {
+        const size_type mask = capacity_ - 1;
+        destroy_value( hole );
+        for ( size_type i = ( hole + 1 ) & mask;; i = ( i + 1 ) & mask ) {
+            const void* addr = address_of( slots_[ i ] );
+            if ( addr == nullptr )
+                break;
+            // The entry may move into the hole only if the hole lies on its
+            // probe path, i.e. between its home slot and i.
+            if ( ( ( i - home( addr ) ) & mask ) >= ( ( i - hole ) & mask ) ) {
+                slots_[ hole ] = std::move( slots_[ i ] );
+                move_value( i, hole );
+                hole = i;
+            }
+        }
+        slots_[ hole ].reset();
+        --size_;
+    }
+
+    size_type first_occupied( size_type i ) const noexcept
+    {
+        while ( i != capacity_ && !slots_[ i ] )
+            ++i;
+        return i;
+    }
+
+    mapped_storage& value_at( size_type i ) const noexcept
+    {
+        return values_[ i ];
+    }
+
+    slot_type& slot_at( size_type i ) const noexcept
+    {
+        return slots_[ i ];
+    }
+
+private:
+    void destroy_value( size_type i ) noexcept
+    {
+        if constexpr ( is_map ) {
+            mapped_alloc alloc( alloc_ );
+            mapped_traits::destroy( alloc, values_ + i );
+        }
+    }
+
+    void move_value( size_type from, size_type to ) noexcept
+    {
+        if constexpr ( is_map ) {
+            mapped_alloc alloc( alloc_ );
+            mapped_traits::construct( alloc, values_ + to, std::move( values_[ from ] ) );
+            mapped_traits::destroy( alloc, values_ + from );
+        }
+    }
+
+    // Owns a freshly allocated slot array until released.
+    struct slots_guard
+    {
+        slot_alloc& alloc;
+        slot_type*  ptr;
+        size_type   n;
+
+        ~slots_guard()
+        {
+            if ( ptr )
+                slot_traits::deallocate( alloc, ptr, n );
+        }
+    };
+
+    void rehash( size_type capacity )
+    {
+        slot_alloc   slots( alloc_ );
+        mapped_alloc values( alloc_ );
+        slots_guard  guard { slots, slot_traits::allocate( slots, capacity ), capacity };
+
+        mapped_storage* new_values = nullptr;
+        if constexpr ( is_map )
+            new_values = mapped_traits::allocate( values, capacity );
+        slot_type* const new_slots = std::exchange( guard.ptr, nullptr );
+        for ( size_type i = 0; i != capacity; ++i )
+            slot_traits::construct( slots, new_slots + i, nullptr );
+
+        slot_type* const      old_slots    = std::exchange( slots_, new_slots );
+        mapped_storage* const old_values   = std::exchange( values_, new_values );
+        const size_type       old_capacity = std::exchange( capacity_, capacity );
+        shift_                             = 64 - unsigned( std::countr_zero( capacity ) );
+
+        // Entries are distinct, so each goes to the first empty slot of its probe.
+        const size_type mask = capacity - 1;
+        for ( size_type i = 0; i != old_capacity; ++i ) {
+            if ( !old_slots[ i ] )
+                continue;
+            size_type to = home( address_of( old_slots[ i ] ) );
+            while ( slots_[ to ] )
+                to = ( to + 1 ) & mask;
+            slots_[ to ] = std::move( old_slots[ i ] );
+            if constexpr ( is_map ) {
+                mapped_traits::construct( values, values_ + to, std::move( old_values[ i ] ) );
+                mapped_traits::destroy( values, old_values + i );
+            }
+        }
+        deallocate( old_slots, old_values, old_capacity );
+    }
+
+    void copy_from( const flat_table& other )
+    {
+        if ( other.size_ == 0 )
+            return;
+        rehash( other.capacity_ );
+        // Same capacity and hash: every entry keeps its slot.
+        for ( size_type i = 0; i != capacity_; ++i ) {
+            if ( !other.slots_[ i ] )
+                continue;
+            if constexpr ( is_map ) {
+                mapped_alloc alloc( alloc_ );
+                mapped_traits::construct( alloc, values_ + i, other.values_[ i ] );
+            }
+            slots_[ i ] = other.slots_[ i ];
+            ++size_;
+        }
+    }
+
+    void deallocate( slot_type* slots, mapped_storage* values, size_type capacity ) noexcept
+    {
+        if ( slots == nullptr )
+            return;
+        slot_alloc salloc( alloc_ );
+        for ( size_type i = 0; i != capacity; ++i )
+            slot_traits::destroy( salloc, slots + i );
+        slot_traits::deallocate( salloc, slots, capacity );
+        if constexpr ( is_map ) {
+            mapped_alloc valloc( alloc_ );
+            mapped_traits::deallocate( valloc, values, capacity );
+        }
+    }
+
+    void release() noexcept
+    {
+        clear();
+        deallocate( slots_, values_, capacity_ );
+        slots_    = nullptr;
+        values_   = nullptr;
+        capacity_ = 0;
+    }
+
+    [[no_unique_address]] Hash      hash_;
+    [[no_unique_address]] Allocator alloc_;
+    slot_type*                      slots_    = nullptr;
+    mapped_storage*                 values_   = nullptr;
+    size_type                       capacity_ = 0;
+    size_type                       size_     = 0;
+    unsigned                        shift_    = 63;
+};
+
+} // namespace detail
+
+/**
+ * @brief A flat, open-addressing hash set of never-null pointers.
+ *
+ * Each slot is an optional_non_null<P>, the size of P itself: a null slot is
+ * empty, so the table needs no control bytes. Keys are identified by address,
+ * and lookup is transparent: contains(), count() and erase() take a raw T*, a
+ * non_null or a smart pointer. Probing compares a SIMD register of raw pointer
+ * slots at a time; smart pointer keys are probed one slot at a time.
+ *
+ * Iterators yield the keys by value as non_null<P>. Inserting may rehash and
+ * invalidates all iterators; erasing shifts later entries back and invalidates
+ * iterators as well.
+ *
+ * @tparam P         A copyable pointer type (T*, std::shared_ptr<T>, intrusive_ptr<T>).
+ * @tparam Hash      Invoked with the address of a key as const void*.
+ * @tparam Allocator An allocator, rebound to the slot type.
+ */
+template < typename P, typename Hash = pointer_hash, typename Allocator = std::allocator< non_null< P > > >
+    requires detail::copyable_pointer< P > && detail::address_like< P >
+class non_null_flat_set : private detail::flat_table< P, void, Hash, Allocator >
+{
+    using base = detail::flat_table< P, void, Hash, Allocator >;
+
+public:
+    using typename base::allocator_type;
+    using typename base::hasher;
+    using typename base::key_type;
+    using typename base::size_type;
+    using value_type      = key_type;
+    using difference_type = std::ptrdiff_t;
+
+    /**
+     * @brief Forward iterator over the keys, yielding non_null<P> by value.
+     */
+    class const_iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = key_type;
+        using difference_type   = std::ptrdiff_t;
+        using reference         = key_type;
+        using pointer           = void;
+
+        const_iterator() = default;
+
+        key_type operator*() const
+        {
+            return *table_->slot_at( index_ );
+        }
+
+        const_iterator& operator++() noexcept
+        {
+            index_ = table_->first_occupied( index_ + 1 );
+            return *this;
+        }
+
+        const_iterator operator++( int ) noexcept
+        {
+            const_iterator tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        friend bool operator==( const const_iterator& lhs, const const_iterator& rhs ) noexcept
+        {
+            return lhs.index_ == rhs.index_;
+        }
+
+    private:
+        friend class non_null_flat_set;
+
+        const_iterator( const non_null_flat_set* table, size_type index ) noexcept :
+            table_( table ),
+            index_( index )
+        {}
+
+        const non_null_flat_set* table_ = nullptr;
+        size_type                index_ = 0;
+    };
+    using iterator = const_iterator;
+
+    non_null_flat_set() = default;
+
+    explicit non_null_flat_set( const Allocator& alloc ) noexcept :
+        base( alloc )
+    {}
+
+    non_null_flat_set( std::initializer_list< key_type > keys, const Allocator& alloc = Allocator() ) :
+        base( alloc )
+    {
+        base::reserve( keys.size() );
+        for ( const key_type& key : keys )
+            insert( key );
+    }
+
+    using base::capacity;
+    using base::clear;
+    using base::contains;
+    using base::count;
+    using base::empty;
+    using base::erase;
+    using base::get_allocator;
+    using base::hash_function;
+    using base::reserve;
+    using base::size;
+
+    /**
+     * @brief Inserts key unless it is already present. Returns the position of
+     *        the key and whether it was inserted.
+     */
+    std::pair< iterator, bool > insert( const key_type& key )
+    {
+        const void*      addr  = detail::address_of( key );
+        detail::flat_probe probe = base::lookup( addr );
+        if ( probe.found )
+            return { iterator( this, probe.index ), false };
+        probe = base::prepare_insert( addr, probe );
+        base::occupy( probe.index, key );
+        return { iterator( this, probe.index ), true };
+    }
+
+    /**
+     * @brief Returns the position of key, or end(). Transparent, like contains().
+     */
+    template < detail::address_lookup_key< typename base::element_type > K >
+    iterator find( const K& key ) const noexcept
+    {
+        const detail::flat_probe probe = base::lookup( detail::address_as< typename base::element_type >( key ) );
+        return probe.found ? iterator( this, probe.index ) : end();
+    }
+
+    iterator begin() const noexcept
+    {
+        return iterator( this, base::first_occupied( 0 ) );
+    }
+
+    iterator end() const noexcept
+    {
+        return iterator( this, base::capacity() );
+    }
+
+    void swap( non_null_flat_set& other ) noexcept
+    {
+        base::swap( other );
+    }
+
+    friend bool operator==( const non_null_flat_set& lhs, const non_null_flat_set& rhs )
+    {
+        if ( lhs.size() != rhs.size() )
+            return false;
+        for ( const key_type& key : lhs )
+            if ( !rhs.contains( key ) )
+                return false;
+        return true;
+    }
+};
+
+/**
+ * @brief A flat, open-addressing hash map keyed by never-null pointers.
+ *
+ * Keys are stored like in non_null_flat_set; the mapped values live in a
+ * parallel array, so probing touches only the key slots. Iterators yield a
+ * std::pair of the key (by value) and a reference to the mapped value. The
+ * mapped type must be nothrow move constructible: rehashing and erasing move
+ * values between slots.
+ *
+ * @tparam P         A copyable pointer type (T*, std::shared_ptr<T>, intrusive_ptr<T>).
+ * @tparam T         The mapped type.
+ * @tparam Hash      Invoked with the address of a key as const void*.
+ * @tparam Allocator An allocator, rebound to the slot and mapped types.
+ */
+template < typename P,
+           typename T,
+           typename Hash      = pointer_hash,
+           typename Allocator = std::allocator< std::pair< const non_null< P >, T > > >
+    requires detail::copyable_pointer< P > && detail::address_like< P >
+class non_null_flat_map : private detail::flat_table< P, T, Hash, Allocator >
+{
+    using base = detail::flat_table< P, T, Hash, Allocator >;
+
+    template < bool Const >
+    class basic_iterator
+    {
+        using table = std::conditional_t< Const, const non_null_flat_map, non_null_flat_map >;
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = std::pair< non_null< P >, T >;
+        using difference_type   = std::ptrdiff_t;
+        using reference         = std::pair< non_null< P >, std::conditional_t< Const, const T&, T& > >;
+
+        // operator-> returns the pair by value, wrapped so that it->second works.
+        struct pointer
+        {
+            reference ref;
+
+            reference* operator->() noexcept
+            {
+                return &ref;
+            }
+        };
+
+        basic_iterator() = default;
+
+        template < bool C >
+            requires( Const && !C )
+        basic_iterator( const basic_iterator< C >& other ) noexcept :
+            table_( other.table_ ),
+            index_( other.index_ )
+        {}
+
+        reference operator*() const
+        {
+            return reference( *table_->slot_at( index_ ), table_->value_at( index_ ) );
+        }
+
+        pointer operator->() const
+        {
+            return pointer { **this };
+        }
+
+        basic_iterator& operator++() noexcept
+        {
+            index_ = table_->first_occupied( index_ + 1 );
+            return *this;
+        }
+
+        basic_iterator operator++( int ) noexcept
+        {
+            basic_iterator tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        friend bool operator==( const basic_iterator& lhs, const basic_iterator& rhs ) noexcept
+        {
+            return lhs.index_ == rhs.index_;
+        }
+
+    private:
+        friend class non_null_flat_map;
+        friend class basic_iterator< true >;
+
+        basic_iterator( table* t, std::size_t index ) noexcept :
+            table_( t ),
+            index_( index )
+        {}
+
+        table*    table_ = nullptr;
+        std::size_t index_ = 0;
+    };
+
+public:
+    using typename base::allocator_type;
+    using typename base::hasher;
+    using typename base::key_type;
+    using typename base::size_type;
+    using mapped_type     = T;
+    using value_type      = std::pair< key_type, T >;
+    using difference_type = std::ptrdiff_t;
+    using iterator        = basic_iterator< false >;
+    using const_iterator  = basic_iterator< true >;
+
+    non_null_flat_map() = default;
+
+    explicit non_null_flat_map( const Allocator& alloc ) noexcept :
+        base( alloc )
+    {}
+
+    non_null_flat_map( std::initializer_list< value_type > values, const Allocator& alloc = Allocator() ) :
+        base( alloc )
+    {
+        base::reserve( values.size() );
+        for ( const value_type& v : values )
+            try_emplace( v.first, v.second );
+    }
+
+    using base::capacity;
+    using base::clear;
+    using base::contains;
+    using base::count;
+    using base::empty;
+    using base::erase;
+    using base::get_allocator;
+    using base::hash_function;
+    using base::reserve;
+    using base::size;
+
+    /**
+     * @brief Constructs a value from args for key unless key is already present;
+     *        args are then left untouched.
+     */
+    template < typename... Args >
+    std::pair< iterator, bool > try_emplace( const key_type& key, Args&&... args )
+    {
+        const void*      addr  = detail::address_of( key );
+        detail::flat_probe probe = base::lookup( addr );
+        if ( probe.found )
+            return { iterator( this, probe.index ), false };
+        probe = base::prepare_insert( addr, probe );
+
+        // Construct the value before occupying the slot: if it throws, the slot
+        // stays empty.
+        base::emplace_value( probe.index, std::forward< Args >( args )... );
+        base::occupy( probe.index, key );
+        return { iterator( this, probe.index ), true };
+    }
+
+    std::pair< iterator, bool > insert( const value_type& value )
+    {
+        return try_emplace( value.first, value.second );
+    }
+
+    template < typename M >
+    std::pair< iterator, bool > insert_or_assign( const key_type& key, M&& value )
+    {
+        auto result = try_emplace( key, std::forward< M >( value ) );
+        if ( !result.second )
+            result.first->second = std::forward< M >( value );
+        return result;
+    }
+
+    T& operator[]( const key_type& key )
+    {
+        return try_emplace( key ).first->second;
+    }
+
+    /**
+     * @brief Returns the value of key; throws std::out_of_range if it is absent.
+     */
+    template < detail::address_lookup_key< typename base::element_type > K >
+    T& at( const K& key )
+    {
+        const detail::flat_probe probe = base::lookup( detail::address_as< typename base::element_type >( key ) );
+        if ( !probe.found )
+            throw std::out_of_range( "nova::non_null_flat_map::at: key not found" );
+        return base::value_at( probe.index );
+    }
+
+    template < detail::address_lookup_key< typename base::element_type > K >
+    const T& at( const K& key ) const
+    {
+        return const_cast< non_null_flat_map& >( *this ).at( key );
+    }
+
+    /**
+     * @brief Returns the position of key, or end(). Transparent, like contains().
+     */
+    template < detail::address_lookup_key< typename base::element_type > K >
+    iterator find( const K& key ) noexcept
+    {
+        const detail::flat_probe probe = base::lookup( detail::address_as< typename base::element_type >( key ) );
+        return probe.found ? iterator( this, probe.index ) : end();
+    }
+
+    template < detail::address_lookup_key< typename base::element_type > K >
+    const_iterator find( const K& key ) const noexcept
+    {
+        return const_cast< non_null_flat_map& >( *this ).find( key );
+    }
+
+    iterator begin() noexcept
+    {
+        return iterator( this, base::first_occupied( 0 ) );
+    }
+
+    iterator end() noexcept
+    {
+        return iterator( this, base::capacity() );
+    }
+
+    const_iterator begin() const noexcept
+    {
+        return const_iterator( this, base::first_occupied( 0 ) );
+    }
+
+    const_iterator end() const noexcept
+    {
+        return const_iterator( this, base::capacity() );
+    }
+
+    void swap( non_null_flat_map& other ) noexcept
+    {
+        base::swap( other );
+    }
+
+    friend bool operator==( const non_null_flat_map& lhs, const non_null_flat_map& rhs )
+    {
+        if ( lhs.size() != rhs.size() )
+            return false;
+        for ( const auto& [ key, value ] : lhs ) {
+            const const_iterator it = rhs.find( key );
+            if ( it == rhs.end() || !( it->second == value ) )
+                return false;
+        }
+        return true;
+    }
+};
+
+/**
+ * @brief ADL swap for non_null_flat_set.
+ */
+template < typename P, typename Hash, typename Allocator >
+void swap( non_null_flat_set< P, Hash, Allocator >& lhs, non_null_flat_set< P, Hash, Allocator >& rhs ) noexcept
+{
+    lhs.swap( rhs );
+}
+
+/**
+ * @brief ADL swap for non_null_flat_map.
+ */
+template < typename P, typename T, typename Hash, typename Allocator >
+void swap( non_null_flat_map< P, T, Hash, Allocator >& lhs,
+           non_null_flat_map< P, T, Hash, Allocator >& rhs ) noexcept
+{
+    lhs.swap( rhs );
+}
+
+} // namespace nova
+
+#include <nova/non_null/detail/epilogue.hpp>
@@ -0,0 +1,1351 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2026 Tim Blechmann
+
+#pragma once
+
+#include <nova/non_null/allocator.hpp>
+
+#include <functional>
+#include <new>
+
+#include <nova/non_null/detail/prologue.hpp>
+
+namespace nova {
+
+// =============================================================================
+// callable helpers
+// =============================================================================
+
+namespace detail {
+
+template < typename F >
+constexpr void assume_not_empty( const F& fn ) noexcept
+{
+    [[maybe_unused]] const bool is_not_empty = static_cast< bool >( fn );
+    assert( is_not_empty && "nova::detail::assume_not_empty: callable cannot be empty" );
+    NOVA_ASSUME( is_not_empty );
+}
+
+/**
+ * @brief Concept: F names a plain function or a pointer to one.
+ * Such callables are stored by value in non-owning views, not by address.
+ */
+template < typename F >
+concept function_pointer_like = std::is_function_v< std::remove_pointer_t< std::decay_t< F > > >;
+
+/**
+ * @brief True if a callable of type F may be empty: a function or member
+ *        pointer, or a type-erased function wrapper. Storing such an F in
+ *        another wrapper must keep it empty rather than hide it.
+ */
+template < typename F >
+inline constexpr bool nullable_callable = std::is_pointer_v< F > || std::is_member_pointer_v< F >;
+
+template < typename Sig >
+inline constexpr bool nullable_callable< std::function< Sig > > = true;
+
+#if defined( __cpp_lib_move_only_function ) && __cpp_lib_move_only_function >= 202110L
+template < typename Sig >
+inline constexpr bool nullable_callable< std::move_only_function< Sig > > = true;
+#endif
+
+#if defined( __cpp_lib_copyable_function )
+template < typename Sig >
+inline constexpr bool nullable_callable< std::copyable_function< Sig > > = true;
+#endif
+
+/**
+ * @brief std::invoke_r for C++20: invokes f and converts the result to R
+ *        (or discards it if R is void).
+ */
+template < typename R, typename F, typename... Args >
+constexpr R invoke_r( F&& f, Args&&... args )
+{
+    if constexpr ( std::is_void_v< R > )
+        std::invoke( std::forward< F >( f ), std::forward< Args >( args )... );
+    else
+        return std::invoke( std::forward< F >( f ), std::forward< Args >( args )... );
+}
+
+#if NOVA_INSTRUMENTATION
+/**
+ * @brief True if the Target stored in the type-erased wrapper fn lives inside
+ *        fn itself (small-buffer optimisation), false if it was heap-allocated.
+ */
+template < typename Target, typename Fn >
+bool target_stored_inline( const Fn& fn ) noexcept
+{
+    const void* target = fn.template target< Target >();
+    const void* first  = static_cast< const void* >( &fn );
+    const void* last   = static_cast< const void* >( &fn + 1 );
+    return target && std::less_equal<>()( first, target ) && std::less<>()( target, last );
+}
+#endif
+
+template < typename F >
+inline constexpr bool is_reference_wrapper = false;
+
+template < typename T >
+inline constexpr bool is_reference_wrapper< std::reference_wrapper< T > > = true;
+
+/**
+ * @brief Estimates whether std::move_only_function stores F inline. The
+ *        standard offers no query for this.
+ *
+ * With libstdc++ the estimate mirrors its layout: a buffer of the wrapper size
+ * minus two pointers (invoker and manager). The estimate is libstdc++-only;
+ * with other standard libraries only function pointers and reference_wrapper,
+ * which the standard recommends storing without allocation, count as inline,
+ * so that nothing that might be allocated is taken for inline.
+ */
+template < typename F, typename Fn >
+constexpr bool move_only_function_stores_inline() noexcept
+{
+#if defined( __GLIBCXX__ )
+    return sizeof( F ) <= sizeof( Fn ) - 2 * sizeof( void* ) && alignof( F ) <= alignof( Fn )
+        && std::is_nothrow_move_constructible_v< F >;
+#else
+    return function_pointer_like< F > || is_reference_wrapper< F >;
+#endif
+}
+
+} // namespace detail
+
+// =============================================================================
+// non_null_fn_ptr
+// =============================================================================
+
+/**
+ * @brief Primary template declaration — only the function-signature
+ *        specialisation below is defined.
+ */
+template < typename Signature, contract_policy Policy = contract_default >
+class non_null_fn_ptr;
+
+namespace detail {
+
+template < typename T >
+struct is_non_null_fn_ptr : std::false_type
+{};
+
+template < typename Sig, typename P >
+struct is_non_null_fn_ptr< non_null_fn_ptr< Sig, P > > : std::true_type
+{};
+
+} // namespace detail
+
+/**
+ * @brief A never-null plain function pointer with signature R(Args...).
+ *
+ * One word and trivially copyable: no type erasure, no manager, no destructor.
+ * The call operator is a single call through the stored pointer (a direct call
+ * once the optimiser knows the target) and performs no check.
+ *
+ * Captureless lambdas convert implicitly and in constant expressions, as their
+ * conversion to a function pointer can never yield null. Raw function pointers
+ * are checked by Policy.
+ *
+ * non_null_function and non_null_function_ref are implicitly constructible from
+ * a non_null_fn_ptr; both store the pointer itself.
+ */
+template < typename R, typename... Args, bool Noexcept, typename Policy >
+class non_null_fn_ptr< R( Args... ) noexcept( Noexcept ), Policy >
+{
+public:
+    using result_type   = R;
+    using pointer       = R ( * )( Args... ) noexcept( Noexcept );
+    using contract_type = Policy;
+
+    /**
+     * @brief Wraps a function pointer.
+     * @param f The function pointer to wrap. Must not be null (checked by Policy).
+     */
+    constexpr explicit non_null_fn_ptr( pointer NOVA_NONNULL       f,
+                                        const std::source_location& where = std::source_location::current() ) :
+        fn_( f )
+    {
+        Policy::check( fn_ != nullptr, "nova::non_null_fn_ptr: function pointer cannot be null", where );
+        detail::nova_count_construction();
+    }
+
+    /**
+     * @brief Converts a captureless lambda (or any stateless class convertible
+     *        to pointer). No check is needed: the conversion cannot yield null.
+     */
+    template < typename F >
+        requires std::is_class_v< F > && std::is_empty_v< F > && std::is_convertible_v< const F&, pointer >
+                 && ( !detail::is_non_null_fn_ptr< F >::value )
+    constexpr non_null_fn_ptr( const F& f ) noexcept :
+        fn_( static_cast< pointer >( f ) )
+    {
+        detail::assume_nonnull( fn_ );
+    }
+
+    /**
+     * @brief Converts from a non_null_fn_ptr with a compatible pointer type, e.g.
+     *        a noexcept signature to the corresponding potentially-throwing one.
+     */
+    template < typename S, typename Q >
+        requires std::is_convertible_v< typename non_null_fn_ptr< S, Q >::pointer, pointer >
+    constexpr non_null_fn_ptr( const non_null_fn_ptr< S, Q >& other ) noexcept :
+        fn_( other.get() )
+    {}
+
+    non_null_fn_ptr( const non_null_fn_ptr& )            = default;
+    non_null_fn_ptr& operator=( const non_null_fn_ptr& ) = default;
+
+    // Prevent null assignment / null construction
+    non_null_fn_ptr( std::nullptr_t )            = delete;
+    non_null_fn_ptr& operator=( std::nullptr_t ) = delete;
+
+    /**
+     * @brief Returns the function pointer.
+     */
+    constexpr pointer NOVA_NONNULL get() const noexcept NOVA_RETURNS_NONNULL
+    {
+        detail::assume_nonnull( fn_ );
+        return fn_;
+    }
+
+    /**
+     * @brief Calls the function. No null check is performed.
+     */
+    constexpr R operator()( Args... args ) const noexcept( Noexcept )
+    {
+        return get()( std::forward< Args >( args )... );
+    }
+
+    /**
+     * @brief Always returns true; the pointer is guaranteed non-null.
+     */
+    constexpr explicit operator bool() const noexcept
+    {
+        return true;
+    }
+
+    /**
+     * @brief Swaps the function pointers. Both objects remain non-null.
+     */
+    constexpr void swap( non_null_fn_ptr& other ) noexcept
+    {
+        std::swap( fn_, other.fn_ );
+    }
+
+    constexpr bool operator==( const non_null_fn_ptr& ) const noexcept = default;
+
+private:
+    pointer fn_;
+};
+
+/**
+ * @brief Deduction guide: deduce the function signature from a plain function
+ *        pointer.
+ */
+template < typename R, typename... Args, bool Noexcept >
+non_null_fn_ptr( R ( *NOVA_NONNULL )( Args... ) noexcept( Noexcept ) )
+    -> non_null_fn_ptr< R( Args... ) noexcept( Noexcept ) >;
+
+/**
+ * @brief Deduction guide: deduce the function signature from a captureless,
+ *        non-generic lambda.
+ */
+template < typename F >
+    requires std::is_class_v< F > && std::is_empty_v< F > && requires( const F& f ) { +f; }
+             && detail::function_pointer_like< decltype( +std::declval< const F& >() ) >
+non_null_fn_ptr( F ) -> non_null_fn_ptr< std::remove_pointer_t< decltype( +std::declval< const F& >() ) > >;
+
+/**
+ * @brief ADL swap for non_null_fn_ptr.
+ */
+template < typename Sig, typename P >
+constexpr void swap( non_null_fn_ptr< Sig, P >& lhs, non_null_fn_ptr< Sig, P >& rhs ) noexcept
+{
+    lhs.swap( rhs );
+}
+
+// =============================================================================
+// non_null_function
+// =============================================================================
+
+/**
+ * @brief Primary template declaration — only the function-signature
+ *        specialisation below is defined.
+ */
+template < typename Signature, contract_policy Policy = contract_default >
+class non_null_function;
+
+/**
+ * @brief A non-null wrapper for std::function<R(Args...)>.
+ *
+ * Guarantees the stored callable is never empty (i.e. bool(fn_) == true).
+ *
+ * The call operator uses this invariant to let the optimiser eliminate the
+ * empty-callable check.
+ *
+ * std::function itself has no qualified signatures; non_null_function<R(Args...)
+ * noexcept> additionally requires a nothrow-invocable callable, so its call
+ * operator is noexcept.
+ */
+template < typename R, typename... Args, bool Noexcept, typename Policy >
+class non_null_function< R( Args... ) noexcept( Noexcept ), Policy >
+{
+public:
+    using result_type   = R;
+    using function_type = std::function< R( Args... ) >;
+    using contract_type = Policy;
+
+    /**
+     * @brief Constructs from any callable that is invocable with (Args...) -> R.
+     * @param f The callable to wrap. Must not be empty (checked by Policy).
+     */
+    template < typename F >
+        requires std::is_invocable_r_v< R, F, Args... > && (!std::is_same_v< std::decay_t< F >, non_null_function >)
+                 && ( !Noexcept || std::is_nothrow_invocable_r_v< R, std::decay_t< F >&, Args... > )
+                 && ( !detail::is_non_null_fn_ptr< std::decay_t< F > >::value )
+    constexpr explicit non_null_function( F&&                         f,
+                                          const std::source_location& where = std::source_location::current() ) :
+        fn_( std::forward< F >( f ) )
+    {
+        Policy::check( static_cast< bool >( fn_ ), "nova::non_null_function: callable cannot be empty", where );
+        detail::nova_count_construction();
+#if NOVA_INSTRUMENTATION && defined( __cpp_rtti )
+        if constexpr ( !std::is_same_v< std::decay_t< F >, function_type > )
+            detail::nova_count_callable( detail::target_stored_inline< std::decay_t< F > >( fn_ ) );
+#endif
+    }
+
+    /**
+     * @brief Stores the function pointer of a non_null_fn_ptr. Needs no check.
+     */
+    template < typename S, typename Q, typename P = typename non_null_fn_ptr< S, Q >::pointer >
+        requires std::is_invocable_r_v< R, P, Args... >
+                 && ( !Noexcept || std::is_nothrow_invocable_r_v< R, P, Args... > )
+    non_null_function( const non_null_fn_ptr< S, Q >& f ) :
+        fn_( f.get() )
+    {
+        detail::nova_count_construction();
+    }
+
+    ~non_null_function()
+    {
+        detail::nova_asan_unpoison( &fn_, sizeof( fn_ ) );
+    }
+
+    // Copy ctor and copy assignment are defaulted (std::function is copyable)
+#if NOVA_INSTRUMENTATION
+    non_null_function( const non_null_function& other ) :
+        fn_( other.fn_ )
+    {
+        detail::nova_count_copy();
+    }
+#else
+    non_null_function( const non_null_function& ) = default;
+#endif
+    non_null_function& operator=( const non_null_function& other )
+    {
+        // Unpoison target storage in case it was poisoned by a previous take().
+        detail::nova_asan_unpoison( &fn_, sizeof( fn_ ) );
+        fn_ = other.fn_;
+        detail::nova_count_copy();
+        return *this;
+    }
+
+    // Implicit move: deleted to prevent accidental moves that leave the
+    // wrapper in an unusable (empty) state. Use take() to transfer ownership explicitly.
+    non_null_function( non_null_function&& )            = delete;
+    non_null_function& operator=( non_null_function&& ) = delete;
+
+    // Prevent null assignment / null construction
+    non_null_function( std::nullptr_t )            = delete;
+    non_null_function& operator=( std::nullptr_t ) = delete;
+
+    /**
+     * @brief Invokes the stored callable.
+     *
+     */
+    template < typename... CallArgs >
+    R operator()( CallArgs&&... args ) const noexcept( Noexcept )
+    {
+        detail::assume_not_empty( fn_ );
+        return fn_( std::forward< CallArgs >( args )... );
+    }
+
+    /**
+     * @brief Returns a const reference to the underlying std::function.
+     * The rvalue overload is deleted to prevent accidental moves leaving this
+     * object empty.
+     */
+    constexpr const function_type& underlying() const& noexcept
+    {
+        return fn_;
+    }
+    function_type underlying() && = delete;
+
+    /**
+     * @brief Always returns true; the callable is guaranteed non-empty.
+     */
+    constexpr explicit operator bool() const noexcept
+    {
+        return true;
+    }
+
+    /**
+     * @brief Swaps the managed callables. Both objects remain non-empty.
+     */
+    constexpr void swap( non_null_function& other ) noexcept
+    {
+        detail::nova_asan_unpoison( &fn_, sizeof( fn_ ) );
+        detail::nova_asan_unpoison( &other.fn_, sizeof( other.fn_ ) );
+        fn_.swap( other.fn_ );
+    }
+
+    /**
+     * @brief Explicitly extracts the underlying std::function, consuming the
+     *        non_null_function wrapper.
+     *
+     * After this call the non_null_function is in a moved-from state and must
+     * not be used.
+     */
+    friend function_type take( non_null_function&& nn ) noexcept
+    {
+        function_type tmp = std::move( nn.fn_ );
+        detail::nova_asan_poison( &nn.fn_, sizeof( nn.fn_ ) );
+        detail::nova_count_take();
+        return tmp;
+    }
+
+private:
+    function_type NOVA_NONNULL_NONTRIVIAL fn_;
+};
+
+/**
+ * @brief Deduction guide: deduce the function signature from a plain function
+ *        pointer.
+ */
+template < typename R, typename... Args, bool Noexcept >
+non_null_function( R ( *NOVA_NONNULL )( Args... ) noexcept( Noexcept ) )
+    -> non_null_function< R( Args... ) noexcept( Noexcept ) >;
+
+/**
+ * @brief ADL swap for non_null_function.
+ */
+template < typename Sig, typename P >
+void swap( non_null_function< Sig, P >& lhs, non_null_function< Sig, P >& rhs ) noexcept
+{
+    lhs.swap( rhs );
+}
+
+// =============================================================================
+// non_null_function_ref
+// =============================================================================
+
+/**
+ * @brief Primary template declaration — only the function-signature
+ *        specialisation below is defined.
+ */
+template < typename Signature >
+class non_null_function_ref;
+
+/**
+ * @brief A non-owning, never-empty reference to a callable with signature R(Args...).
+ *
+ * Stores an object pointer (or function pointer) plus a trampoline pointer: two
+ * words, trivially copyable, never allocates. The referenced callable must
+ * outlive the non_null_function_ref, so it is intended for synchronous callback
+ * parameters rather than for storage.
+ *
+ * As the trampoline is always set, the call operator performs no empty check.
+ */
+template < typename R, typename... Args >
+class non_null_function_ref< R( Args... ) >
+{
+    union storage
+    {
+        void const* obj;
+        void ( *fn )();
+    };
+
+    using thunk_type = R ( * )( storage, Args&&... );
+
+public:
+    using result_type = R;
+
+    /**
+     * @brief References any callable object that is invocable with (Args...) -> R.
+     * @param f The callable to reference. If contextually convertible to bool
+     *          (e.g. std::function), it must not be empty (assert-checked).
+     */
+    template < typename F >
+        requires std::is_invocable_r_v< R, F&, Args... >
+                 && (!std::is_same_v< std::remove_cvref_t< F >, non_null_function_ref >)
+                 && (!detail::function_pointer_like< F >) && (!std::is_member_pointer_v< std::decay_t< F > >)
+                 && ( !detail::is_non_null_fn_ptr< std::remove_cvref_t< F > >::value )
+    constexpr non_null_function_ref( F&& f ) noexcept :
+        storage_ { .obj = std::addressof( f ) },
+        thunk_( &invoke_object< std::remove_reference_t< F > > )
+    {
+        if constexpr ( std::is_constructible_v< bool, F& > )
+            detail::assume_not_empty( f );
+    }
+
+    /**
+     * @brief References a plain function. The function pointer is stored by value.
+     * @param f The function to reference. Must not be null (assert-checked).
+     */
+    template < typename F >
+        requires std::is_function_v< F > && std::is_invocable_r_v< R, F*, Args... >
+    non_null_function_ref( F* NOVA_NONNULL f ) noexcept :
+        storage_ { .fn = reinterpret_cast< void ( * )() >( f ) },
+        thunk_( &invoke_function< F > )
+    {
+        detail::assume_nonnull( f );
+    }
+
+    /**
+     * @brief References the function of a non_null_fn_ptr. The pointer is stored
+     *        by value, so the non_null_fn_ptr need not outlive the reference.
+     */
+    template < typename S, typename Q >
+        requires std::is_invocable_r_v< R, typename non_null_fn_ptr< S, Q >::pointer, Args... >
+    non_null_function_ref( const non_null_fn_ptr< S, Q >& f ) noexcept :
+        storage_ { .fn = reinterpret_cast< void ( * )() >( f.get() ) },
+        thunk_( &invoke_function< std::remove_pointer_t< typename non_null_fn_ptr< S, Q >::pointer > > )
+    {}
+
+    non_null_function_ref( const non_null_function_ref& )            = default;
+    non_null_function_ref& operator=( const non_null_function_ref& ) = default;
+
+    // Prevent null assignment / null construction
+    non_null_function_ref( std::nullptr_t )            = delete;
+    non_null_function_ref& operator=( std::nullptr_t ) = delete;
+
+    /**
+     * @brief Invokes the referenced callable.
+     */
+    R operator()( Args... args ) const
+    {
+        return thunk_( storage_, std::forward< Args >( args )... );
+    }
+
+    /**
+     * @brief Always returns true; the view is guaranteed to reference a callable.
+     */
+    constexpr explicit operator bool() const noexcept
+    {
+        return true;
+    }
+
+    /**
+     * @brief Swaps the referenced callables. Both objects remain non-empty.
+     */
+    constexpr void swap( non_null_function_ref& other ) noexcept
+    {
+        std::swap( storage_, other.storage_ );
+        std::swap( thunk_, other.thunk_ );
+    }
+
+private:
+    template < typename T >
+    static R invoke_object( storage s, Args&&... args )
+    {
+        T* obj = static_cast< T* >( const_cast< void* >( s.obj ) );
+        return detail::invoke_r< R >( *obj, std::forward< Args >( args )... );
+    }
+
+    template < typename F >
+    static R invoke_function( storage s, Args&&... args )
+    {
+        F* fn = reinterpret_cast< F* >( s.fn );
+        return detail::invoke_r< R >( fn, std::forward< Args >( args )... );
+    }
+
+    storage    storage_;
+    thunk_type thunk_;
+};
+
+/**
+ * @brief Deduction guide: deduce the function signature from a plain function
+ *        pointer.
+ */
+template < typename R, typename... Args >
+non_null_function_ref( R ( *NOVA_NONNULL )( Args... ) ) -> non_null_function_ref< R( Args... ) >;
+
+/**
+ * @brief ADL swap for non_null_function_ref.
+ */
+template < typename Sig >
+void swap( non_null_function_ref< Sig >& lhs, non_null_function_ref< Sig >& rhs ) noexcept
+{
+    lhs.swap( rhs );
+}
+
+#if defined( __cpp_lib_move_only_function ) && __cpp_lib_move_only_function >= 202110L
+
+// =============================================================================
+// qualified owning callable wrappers (C++23 / C++26)
+// =============================================================================
+
+namespace detail {
+
+template < typename Function >
+inline constexpr const char* empty_callable_message = "nova: callable cannot be empty";
+
+template < typename Sig >
+inline constexpr const char* empty_callable_message< std::move_only_function< Sig > >
+    = "nova::non_null_move_only_function: callable cannot be empty";
+
+#    if defined( __cpp_lib_copyable_function )
+template < typename Sig >
+inline constexpr const char* empty_callable_message< std::copyable_function< Sig > >
+    = "nova::non_null_copyable_function: callable cannot be empty";
+#    endif
+
+/**
+ * @brief Owning handle to a callable allocated through an allocator.
+ *
+ * Stored by allocator-constructed non_null_move_only_function and
+ * non_null_copyable_function objects in place of a callable that would not fit
+ * the small buffer. The allocator is kept in the allocation next to the
+ * callable, so the handle is a single pointer, small enough to be stored
+ * inline itself whatever the size of the allocator.
+ * The call operators forward the value category, so every cv/ref qualified
+ * signature accepts the handle exactly when it accepts F.
+ */
+template < typename F, typename Alloc >
+class allocated_callable
+{
+    struct block;
+    using block_alloc  = rebind_alloc_t< block, Alloc >;
+    using block_traits = std::allocator_traits< block_alloc >;
+
+    struct block
+    {
+        template < typename G >
+        block( const block_alloc& a, G&& g ) :
+            alloc( a ),
+            f( std::forward< G >( g ) )
+        {}
+
+        [[no_unique_address]] block_alloc alloc;
+        F                                 f;
+    };
+
+    static_assert( std::is_pointer_v< typename block_traits::pointer >,
+                   "nova::allocated_callable: fancy allocator pointers are not supported" );
+
+public:
+    template < typename A, typename G >
+    allocated_callable( const A& alloc, G&& g )
+    {
+        block_alloc                     a( alloc );
+        allocation_guard< block_alloc > guard { a, block_traits::allocate( a, 1 ), 1 };
+        block_traits::construct( a, guard.ptr, a, std::forward< G >( g ) );
+        guard.constructed = 1;
+        block_            = guard.release();
+    }
+
+    allocated_callable( const allocated_callable& other )
+        requires std::is_copy_constructible_v< F >
+        :
+        allocated_callable( block_traits::select_on_container_copy_construction( other.block_->alloc ),
+                            std::as_const( other.block_->f ) )
+    {}
+
+    allocated_callable( allocated_callable&& other ) noexcept :
+        block_( std::exchange( other.block_, nullptr ) )
+    {}
+
+    allocated_callable& operator=( const allocated_callable& ) = delete;
+
+    ~allocated_callable()
+    {
+        if ( block_ ) {
+            block_alloc a( block_->alloc );
+            block_traits::destroy( a, block_ );
+            block_traits::deallocate( a, block_, 1 );
+        }
+    }
+
+    template < typename... Args >
+    auto operator()( Args&&... args ) & noexcept( std::is_nothrow_invocable_v< F&, Args... > )
+        -> std::invoke_result_t< F&, Args... >
+    {
+        return std::invoke( block_->f, std::forward< Args >( args )... );
+    }
+
+    template < typename... Args >
+    auto operator()( Args&&... args ) const& noexcept( std::is_nothrow_invocable_v< const F&, Args... > )
+        -> std::invoke_result_t< const F&, Args... >
+    {
+        return std::invoke( std::as_const( block_->f ), std::forward< Args >( args )... );
+    }
+
+    template < typename... Args >
+    auto operator()( Args&&... args ) && noexcept( std::is_nothrow_invocable_v< F, Args... > )
+        -> std::invoke_result_t< F, Args... >
+    {
+        return std::invoke( std::move( block_->f ), std::forward< Args >( args )... );
+    }
+
+    template < typename... Args >
+    auto operator()( Args&&... args ) const&& noexcept( std::is_nothrow_invocable_v< const F, Args... > )
+        -> std::invoke_result_t< const F, Args... >
+    {
+        return std::invoke( std::move( std::as_const( block_->f ) ), std::forward< Args >( args )... );
+    }
+
+private:
+    block* block_;
+};
+
+inline std::pmr::polymorphic_allocator< std::byte > resource_allocator( std::pmr::memory_resource* NOVA_NONNULL mr )
+{
+    assert( mr && "nova: memory resource cannot be null" );
+    return std::pmr::polymorphic_allocator< std::byte >( mr );
+}
+
+/**
+ * @brief State shared by non_null_move_only_function and
+ *        non_null_copyable_function: everything except the call operator,
+ *        whose cv/ref/noexcept qualifiers depend on the signature.
+ *
+ * Copy operations are provided only if Function is copyable; moves are
+ * always deleted, take() transfers ownership.
+ */
+template < typename Function, typename Policy >
+class non_null_callable_base
+{
+public:
+    using function_type = Function;
+    using contract_type = Policy;
+
+    /**
+     * @brief Constructs from any callable that Function accepts, i.e. one that
+     *        is invocable with the qualifiers of the signature.
+     * @param f The callable to wrap. Must not be empty (checked by Policy).
+     */
+    template < typename F >
+        requires( !std::is_base_of_v< non_null_callable_base, std::remove_cvref_t< F > > )
+                && std::is_constructible_v< function_type, F >
+    constexpr explicit non_null_callable_base( F&&                         f,
+                                               const std::source_location& where = std::source_location::current() ) :
+        fn_( std::forward< F >( f ) )
+    {
+        Policy::check( static_cast< bool >( fn_ ), empty_callable_message< function_type >, where );
+        nova_count_construction();
+#    if NOVA_INSTRUMENTATION
+        if constexpr ( !std::is_same_v< std::decay_t< F >, function_type > ) {
+            using stored = std::decay_t< F >;
+            nova_count_callable( move_only_function_stores_inline< stored, function_type >() );
+        }
+#    endif
+    }
+
+    /**
+     * @brief Constructs from f, allocating it through alloc if Function would
+     *        not store it inline.
+     *
+     * A callable that is known to fit the small buffer (see
+     * move_only_function_stores_inline) is stored exactly as by the
+     * constructor above, and the allocator is not kept. Any other one is
+     * allocated through alloc; Function then stores an allocated_callable
+     * handle inline, which deallocates through alloc when the callable is
+     * destroyed, also after take().
+     */
+    template < allocator_like Alloc, typename F >
+        requires( !std::is_base_of_v< non_null_callable_base, std::remove_cvref_t< F > > )
+                && std::is_constructible_v< function_type, F >
+    non_null_callable_base( std::allocator_arg_t,
+                            const Alloc&                alloc,
+                            F&&                         f,
+                            const std::source_location& where = std::source_location::current() ) :
+        fn_( make_function( alloc, std::forward< F >( f ) ) )
+    {
+        Policy::check( static_cast< bool >( fn_ ), empty_callable_message< function_type >, where );
+        nova_count_construction();
+        if constexpr ( !std::is_same_v< std::decay_t< F >, function_type > )
+            nova_count_callable( move_only_function_stores_inline< std::decay_t< F >, function_type >() );
+    }
+
+    /**
+     * @brief Like the allocator constructor, allocating a large callable from
+     *        mr, which must not be null.
+     */
+    template < typename F >
+        requires( !std::is_base_of_v< non_null_callable_base, std::remove_cvref_t< F > > )
+                && std::is_constructible_v< function_type, F >
+    non_null_callable_base( std::allocator_arg_t,
+                            std::pmr::memory_resource* NOVA_NONNULL mr,
+                            F&&                                     f,
+                            const std::source_location&             where = std::source_location::current() ) :
+        non_null_callable_base( std::allocator_arg, resource_allocator( mr ), std::forward< F >( f ), where )
+    {}
+
+    ~non_null_callable_base()
+    {
+        nova_asan_unpoison( &fn_, sizeof( fn_ ) );
+    }
+
+    non_null_callable_base( const non_null_callable_base& other )
+        requires std::is_copy_constructible_v< function_type >
+        :
+        fn_( other.fn_ )
+    {
+        nova_count_copy();
+    }
+
+    non_null_callable_base& operator=( const non_null_callable_base& other )
+        requires std::is_copy_assignable_v< function_type >
+    {
+        // Unpoison target storage in case it was poisoned by a previous take().
+        nova_asan_unpoison( &fn_, sizeof( fn_ ) );
+        fn_ = other.fn_;
+        nova_count_copy();
+        return *this;
+    }
+
+    // Implicit move: deleted to prevent accidental moves that leave the
+    // wrapper in an unusable (empty) state. Use take() to transfer ownership explicitly.
+    non_null_callable_base( non_null_callable_base&& )            = delete;
+    non_null_callable_base& operator=( non_null_callable_base&& ) = delete;
+
+    // Prevent null assignment / null construction
+    non_null_callable_base( std::nullptr_t )            = delete;
+    non_null_callable_base& operator=( std::nullptr_t ) = delete;
+
+    /**
+     * @brief Returns a const reference to the underlying std wrapper.
+     */
+    constexpr const function_type& underlying() const& noexcept
+    {
+        return fn_;
+    }
+    function_type underlying() && = delete;
+
+    /**
+     * @brief Always returns true; the callable is guaranteed non-empty.
+     */
+    constexpr explicit operator bool() const noexcept
+    {
+        return true;
+    }
+
+    /**
+     * @brief Swaps the managed callables. Both objects remain non-empty.
+     */
+    constexpr void swap( non_null_callable_base& other ) noexcept
+    {
+        nova_asan_unpoison( &fn_, sizeof( fn_ ) );
+        nova_asan_unpoison( &other.fn_, sizeof( other.fn_ ) );
+        fn_.swap( other.fn_ );
+    }
+
+    /**
+     * @brief Explicitly extracts the underlying std wrapper, consuming the
+     *        non_null wrapper.
+     *
+     * After this call the wrapper is in a moved-from state and must not be used.
+     * This is the only safe way to transfer ownership out of the wrapper,
+     * mirroring take() for non_null<unique_ptr>.
+     */
+    friend function_type take( non_null_callable_base&& nn ) noexcept
+    {
+        function_type tmp = std::move( nn.fn_ );
+        nova_asan_poison( &nn.fn_, sizeof( nn.fn_ ) );
+        nova_count_take();
+        return tmp;
+    }
+
+protected:
+    function_type NOVA_NONNULL_NONTRIVIAL fn_;
+
+private:
+    template < typename Alloc, typename F >
+    static function_type make_function( const Alloc& alloc, F&& f )
+    {
+        using stored = std::decay_t< F >;
+        // A function_type is only relocated; it must not be wrapped, or its emptiness would be hidden.
+        if constexpr ( move_only_function_stores_inline< stored, function_type >()
+                       || std::is_same_v< stored, function_type > ) {
+            return function_type( std::forward< F >( f ) );
+        } else {
+            using handle = allocated_callable< stored, Alloc >;
+            static_assert( sizeof( handle ) == sizeof( void* ) );
+#    if defined( __GLIBCXX__ )
+            static_assert( move_only_function_stores_inline< handle, function_type >(),
+                           "nova: the allocated_callable handle must be stored inline" );
+#    endif
+            // An empty source is not wrapped, so that the contract check sees it.
+            if constexpr ( nullable_callable< stored > )
+                if ( !static_cast< bool >( f ) )
+                    return function_type();
+            return function_type( std::in_place_type< handle >, alloc, std::forward< F >( f ) );
+        }
+    }
+};
+
+} // namespace detail
+
+/* Defines the partial specialisation of WRAPPER (over std::FUNCTION) for the
+   signatures R(Args...) CV REF noexcept(N). INVOKE is empty, or std::move for
+   rvalue-qualified signatures. */
+#    define NOVA_DETAIL_DEFINE_CALLABLE_WRAPPER( WRAPPER, FUNCTION, CV, REF, INVOKE )                                  \
+        template < typename R, typename... Args, bool Noexcept, typename Policy >                                      \
+        class WRAPPER< R( Args... ) CV REF noexcept( Noexcept ), Policy > :                                            \
+            public detail::non_null_callable_base< std::FUNCTION< R( Args... ) CV REF noexcept( Noexcept ) >, Policy > \
+        {                                                                                                              \
+            using base                                                                                                 \
+                = detail::non_null_callable_base< std::FUNCTION< R( Args... ) CV REF noexcept( Noexcept ) >, Policy >; \
+                                                                                                                       \
+        public:                                                                                                        \
+            using result_type = R;                                                                                     \
+            using base::base;                                                                                          \
+                                                                                                                       \
+            template < typename... CallArgs >                                                                          \
+            R operator()( CallArgs&&... args ) CV REF noexcept( Noexcept )                                             \
+            {                                                                                                          \
+                detail::assume_not_empty( this->fn_ );                                                                 \
+                return INVOKE( this->fn_ )( std::forward< CallArgs >( args )... );                                     \
+            }                                                                                                          \
+        };
+
+#    define NOVA_DETAIL_DEFINE_CALLABLE_WRAPPERS( WRAPPER, FUNCTION )             \
+        NOVA_DETAIL_DEFINE_CALLABLE_WRAPPER( WRAPPER, FUNCTION, , , )             \
+        NOVA_DETAIL_DEFINE_CALLABLE_WRAPPER( WRAPPER, FUNCTION, , &, )            \
+        NOVA_DETAIL_DEFINE_CALLABLE_WRAPPER( WRAPPER, FUNCTION, , &&, std::move ) \
+        NOVA_DETAIL_DEFINE_CALLABLE_WRAPPER( WRAPPER, FUNCTION, const, , )        \
+        NOVA_DETAIL_DEFINE_CALLABLE_WRAPPER( WRAPPER, FUNCTION, const, &, )       \
+        NOVA_DETAIL_DEFINE_CALLABLE_WRAPPER( WRAPPER, FUNCTION, const, &&, std::move )
+
+// =============================================================================
+// non_null_move_only_function  (C++23)
+// =============================================================================
+
+/**
+ * @brief A non-null wrapper for std::move_only_function<Signature>.
+ *
+ * Guarantees the stored callable is never empty (i.e. bool(fn_) == true).
+ *
+ * The call operator uses this invariant to let the optimiser eliminate the
+ * empty-callable check.
+ *
+ * Signature accepts the qualifiers of std::move_only_function: const, & / &&
+ * and noexcept, e.g. non_null_move_only_function<void() noexcept>. A noexcept
+ * signature lets callers omit the exception-unwinding path around the call.
+ *
+ * Construction with (std::allocator_arg, alloc, f), or with a
+ * std::pmr::memory_resource* in place of alloc, allocates a callable that does
+ * not fit the small buffer through the allocator instead of the global heap.
+ *
+ * Note: unlike the name suggests, the function wrapper is not movable. To prevent
+ * accidental moves that would leave the wrapper empty. Use take() to transfer
+ * ownership explicitly.
+ */
+template < typename Signature, contract_policy Policy = contract_default >
+class non_null_move_only_function;
+
+NOVA_DETAIL_DEFINE_CALLABLE_WRAPPERS( non_null_move_only_function, move_only_function )
+
+/**
+ * @brief ADL swap for non_null_move_only_function.
+ */
+template < typename Sig, typename P >
+void swap( non_null_move_only_function< Sig, P >& lhs, non_null_move_only_function< Sig, P >& rhs ) noexcept
+{
+    lhs.swap( rhs );
+}
+
+#    if defined( __cpp_lib_copyable_function )
+
+// =============================================================================
+// non_null_copyable_function  (C++26)
+// =============================================================================
+
+/**
+ * @brief A non-null wrapper for std::copyable_function<Signature>.
+ *
+ * Like non_null_move_only_function, including the qualified signatures, but
+ * copyable. As with non_null_function, moves are deleted; copy, or take() to
+ * transfer ownership.
+ */
+template < typename Signature, contract_policy Policy = contract_default >
+class non_null_copyable_function;
+
+NOVA_DETAIL_DEFINE_CALLABLE_WRAPPERS( non_null_copyable_function, copyable_function )
+
+/**
+ * @brief ADL swap for non_null_copyable_function.
+ */
+template < typename Sig, typename P >
+void swap( non_null_copyable_function< Sig, P >& lhs, non_null_copyable_function< Sig, P >& rhs ) noexcept
+{
+    lhs.swap( rhs );
+}
+
+#    endif // __cpp_lib_copyable_function
+
+#    undef NOVA_DETAIL_DEFINE_CALLABLE_WRAPPERS
+#    undef NOVA_DETAIL_DEFINE_CALLABLE_WRAPPER
+
+#endif // __cpp_lib_move_only_function
+
+// =============================================================================
+// inplace_function / non_null_inplace_function
+// =============================================================================
+
+/**
+ * @brief Default inline capacity of inplace_function, in bytes.
+ */
+inline constexpr std::size_t inplace_function_default_capacity = 4 * sizeof( void* );
+
+/**
+ * @brief Primary template declaration — only the function-signature
+ *        specialisation below is defined.
+ */
+template < typename Signature,
+           std::size_t Capacity  = inplace_function_default_capacity,
+           std::size_t Alignment = alignof( std::max_align_t ) >
+class inplace_function;
+
+namespace detail {
+
+template < typename Sig, std::size_t Capacity, std::size_t Alignment >
+inline constexpr bool nullable_callable< inplace_function< Sig, Capacity, Alignment > > = true;
+
+} // namespace detail
+
+/**
+ * @brief A move-only type-erased callable with fixed inline storage.
+ *
+ * Like std::move_only_function<R(Args...)>, but the callable is always stored in
+ * an inline buffer of Capacity bytes aligned to Alignment and never on the heap.
+ * A callable that does not fit is rejected with a static_assert. Callables must be
+ * nothrow move constructible, so moving the wrapper cannot fail.
+ *
+ * An inplace_function may be empty; non_null_inplace_function adds the
+ * never-empty guarantee.
+ */
+template < typename R, typename... Args, std::size_t Capacity, std::size_t Alignment >
+class inplace_function< R( Args... ), Capacity, Alignment >
+{
+    static_assert( Capacity > 0, "nova::inplace_function: capacity must not be zero" );
+
+    struct vtable
+    {
+        R ( *invoke )( void*, Args&&... );
+        void ( *relocate )( void* dst, void* src ) noexcept;
+        void ( *destroy )( void* ) noexcept;
+    };
+
+    template < typename F >
+    struct ops
+    {
+        static F* object( void* p ) noexcept
+        {
+            return std::launder( static_cast< F* >( p ) );
+        }
+
+        static R invoke( void* self, Args&&... args )
+        {
+            return detail::invoke_r< R >( *object( self ), std::forward< Args >( args )... );
+        }
+
+        // Move-constructs the callable into dst and destroys the one in src.
+        static void relocate( void* dst, void* src ) noexcept
+        {
+            F* from = object( src );
+            ::new ( dst ) F( std::move( *from ) );
+            from->~F();
+        }
+
+        static void destroy( void* self ) noexcept
+        {
+            object( self )->~F();
+        }
+
+        static constexpr vtable table {
+            &invoke,
+            &relocate,
+            &destroy,
+        };
+    };
+
+public:
+    using result_type = R;
+
+    static constexpr std::size_t capacity  = Capacity;
+    static constexpr std::size_t alignment = Alignment;
+
+    /**
+     * @brief Constructs an empty inplace_function.
+     */
+    inplace_function() noexcept = default;
+    inplace_function( std::nullptr_t ) noexcept
+    {}
+
+    /**
+     * @brief Constructs from any callable that is invocable with (Args...) -> R.
+     *
+     * The callable must fit into Capacity bytes, must not require an alignment
+     * larger than Alignment and must be nothrow move constructible. A null function
+     * or member pointer, or an empty function wrapper, yields an empty
+     * inplace_function.
+     */
+    template < typename F >
+        requires std::is_invocable_r_v< R, std::decay_t< F >&, Args... >
+                 && (!std::is_same_v< std::remove_cvref_t< F >, inplace_function >)
+                 && std::is_constructible_v< std::decay_t< F >, F >
+    inplace_function( F&& f ) noexcept( std::is_nothrow_constructible_v< std::decay_t< F >, F > )
+    {
+        using stored_type = std::decay_t< F >;
+        static_assert( sizeof( stored_type ) <= Capacity,
+                       "nova::inplace_function: callable does not fit into the inline capacity" );
+        static_assert( alignof( stored_type ) <= Alignment,
+                       "nova::inplace_function: callable requires a larger alignment than the inline storage" );
+        static_assert( std::is_nothrow_move_constructible_v< stored_type >,
+                       "nova::inplace_function: callable must be nothrow move constructible" );
+
+        if constexpr ( detail::nullable_callable< stored_type > ) {
+            if ( !static_cast< bool >( f ) )
+                return;
+        }
+
+        ::new ( static_cast< void* >( storage_ ) ) stored_type( std::forward< F >( f ) );
+        vtable_ = &ops< stored_type >::table;
+    }
+
+    inplace_function( const inplace_function& )            = delete;
+    inplace_function& operator=( const inplace_function& ) = delete;
+
+    inplace_function( inplace_function&& other ) noexcept :
+        vtable_( other.vtable_ )
+    {
+        if ( vtable_ ) {
+            vtable_->relocate( storage_, other.storage_ );
+            other.vtable_ = nullptr;
+        }
+    }
+
+    inplace_function& operator=( inplace_function&& other ) noexcept
+    {
+        if ( this != &other ) {
+            reset();
+            if ( other.vtable_ ) {
+                other.vtable_->relocate( storage_, other.storage_ );
+                vtable_       = other.vtable_;
+                other.vtable_ = nullptr;
+            }
+        }
+        return *this;
+    }
+
+    inplace_function& operator=( std::nullptr_t ) noexcept
+    {
+        reset();
+        return *this;
+    }
+
+    ~inplace_function()
+    {
+        reset();
+    }
+
+    /**
+     * @brief Invokes the stored callable. The behaviour is undefined if empty.
+     */
+    R operator()( Args... args )
+    {
+        return vtable_->invoke( storage_, std::forward< Args >( args )... );
+    }
+
+    /**
+     * @brief Returns true if a callable is stored.
+     */
+    explicit operator bool() const noexcept
+    {
+        return vtable_ != nullptr;
+    }
+
+    /**
+     * @brief Swaps the stored callables.
+     */
+    void swap( inplace_function& other ) noexcept
+    {
+        inplace_function tmp( std::move( other ) );
+        other = std::move( *this );
+        *this = std::move( tmp );
+    }
+
+    friend bool operator==( const inplace_function& f, std::nullptr_t ) noexcept
+    {
+        return !f;
+    }
+
+private:
+    void reset() noexcept
+    {
+        if ( vtable_ ) {
+            vtable_->destroy( storage_ );
+            vtable_ = nullptr;
+        }
+    }
+
+    alignas( Alignment ) std::byte storage_[ Capacity ];
+    const vtable* vtable_ = nullptr;
+};
+
+/**
+ * @brief ADL swap for inplace_function.
+ */
+template < typename Sig, std::size_t Capacity, std::size_t Alignment >
+void swap( inplace_function< Sig, Capacity, Alignment >& lhs,
+           inplace_function< Sig, Capacity, Alignment >& rhs ) noexcept
+{
+    lhs.swap( rhs );
+}
+
+/**
+ * @brief Primary template declaration.
+ */
+template < typename Signature,
+           std::size_t Capacity  = inplace_function_default_capacity,
+           std::size_t Alignment = alignof( std::max_align_t ) >
+class non_null_inplace_function;
+
+/**
+ * @brief A non-null wrapper for inplace_function<R(Args...), Capacity, Alignment>.
+ *
+ * Guarantees the stored callable is never empty and never heap-allocated: a
+ * callable that does not fit into the inline storage is a compile-time error.
+ *
+ * The call operator uses the non-empty invariant to let the optimiser eliminate
+ * the empty-callable check.
+ *
+ * Like non_null_move_only_function, the wrapper is not implicitly movable. Use
+ * take() to transfer ownership explicitly.
+ */
+template < typename R, typename... Args, std::size_t Capacity, std::size_t Alignment >
+class non_null_inplace_function< R( Args... ), Capacity, Alignment >
+{
+public:
+    using result_type   = R;
+    using function_type = inplace_function< R( Args... ), Capacity, Alignment >;
+
+    static constexpr std::size_t capacity  = Capacity;
+    static constexpr std::size_t alignment = Alignment;
+
+    /**
+     * @brief Constructs from any callable that is invocable with (Args...) -> R.
+     * @param f The callable to wrap. Must fit into the inline storage (static_assert)
+     *          and must not be empty (assert-checked).
+     */
+    template < typename F >
+        requires std::is_invocable_r_v< R, std::decay_t< F >&, Args... >
+                 && (!std::is_same_v< std::decay_t< F >, non_null_inplace_function >)
+    explicit non_null_inplace_function( F&& f ) noexcept( std::is_nothrow_constructible_v< function_type, F > ) :
+        fn_( std::forward< F >( f ) )
+    {
+        detail::assume_not_empty( fn_ );
+        detail::nova_count_construction();
+        detail::nova_count_callable( true );
+    }
+
+    ~non_null_inplace_function()
+    {
+        detail::nova_asan_unpoison( &fn_, sizeof( fn_ ) );
+    }
+
+    // Copy: deleted (inplace_function is not copyable)
+    non_null_inplace_function( const non_null_inplace_function& )            = delete;
+    non_null_inplace_function& operator=( const non_null_inplace_function& ) = delete;
+
+    // Implicit move: deleted to prevent accidental moves that leave the
+    // wrapper in an unusable (empty) state. Use take() to transfer ownership explicitly.
+    non_null_inplace_function( non_null_inplace_function&& )            = delete;
+    non_null_inplace_function& operator=( non_null_inplace_function&& ) = delete;
+
+    // Prevent null assignment / null construction
+    non_null_inplace_function( std::nullptr_t )            = delete;
+    non_null_inplace_function& operator=( std::nullptr_t ) = delete;
+
+    /**
+     * @brief Invokes the stored callable.
+     *
+     */
+    template < typename... CallArgs >
+    R operator()( CallArgs&&... args )
+    {
+        detail::assume_not_empty( fn_ );
+        return fn_( std::forward< CallArgs >( args )... );
+    }
+
+    /**
+     * @brief Returns a const reference to the underlying inplace_function.
+     */
+    constexpr const function_type& underlying() const& noexcept
+    {
+        return fn_;
+    }
+    function_type underlying() && = delete;
+
+    /**
+     * @brief Always returns true; the callable is guaranteed non-empty.
+     */
+    constexpr explicit operator bool() const noexcept
+    {
+        return true;
+    }
+
+    /**
+     * @brief Swaps the managed callables. Both objects remain non-empty.
+     */
+    void swap( non_null_inplace_function& other ) noexcept
+    {
+        detail::nova_asan_unpoison( &fn_, sizeof( fn_ ) );
+        detail::nova_asan_unpoison( &other.fn_, sizeof( other.fn_ ) );
+        fn_.swap( other.fn_ );
+    }
+
+    /**
+     * @brief Explicitly extracts the underlying inplace_function, consuming the
+     *        non_null_inplace_function wrapper.
+     *
+     * After this call the wrapper is in a moved-from state and must not be used.
+     */
+    friend function_type take( non_null_inplace_function&& nn ) noexcept
+    {
+        function_type tmp = std::move( nn.fn_ );
+        detail::nova_asan_poison( &nn.fn_, sizeof( nn.fn_ ) );
+        detail::nova_count_take();
+        return tmp;
+    }
+
+private:
+    function_type fn_;
+};
+
+/**
+ * @brief ADL swap for non_null_inplace_function.
+ */
+template < typename Sig, std::size_t Capacity, std::size_t Alignment >
+void swap( non_null_inplace_function< Sig, Capacity, Alignment >& lhs,
+           non_null_inplace_function< Sig, Capacity, Alignment >& rhs ) noexcept
+{
+    lhs.swap( rhs );
+}
+
+} // namespace nova
+
+/**
+ * @brief Hashes non_null_fn_ptr by its function pointer.
+ */
+template < typename Sig, typename P >
+struct std::hash< nova::non_null_fn_ptr< Sig, P > >
+{
+    std::size_t operator()( const nova::non_null_fn_ptr< Sig, P >& fn ) const noexcept
+    {
+        return std::hash< typename nova::non_null_fn_ptr< Sig, P >::pointer > {}( fn.get() );
+    }
+};
+
+#include <nova/non_null/detail/epilogue.hpp>
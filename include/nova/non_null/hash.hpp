@@ -0,0 +1,213 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2026 Tim Blechmann
+
+#pragma once
+
+#include <nova/non_null/optional.hpp>
+#include <nova/non_null/smart_ptr.hpp>
+
+#include <functional>
+
+#include <nova/non_null/detail/prologue.hpp>
+
+namespace nova {
+
+// =============================================================================
+// hashing and transparent comparison
+// =============================================================================
+
+namespace detail {
+
+/**
+ * @brief Concept: P is a raw pointer, exposes its pointee through get()
+ *        (smart pointers, non_null, optional_non_null), or is a fancy pointer.
+ */
+template < typename P >
+concept address_like = std::is_pointer_v< P > || fancy_pointer< P > || requires( const P& p ) {
+    { detail::to_address( p.get() ) } -> std::convertible_to< const volatile void* >;
+};
+
+template < address_like P >
+using address_element_t = std::remove_cv_t< std::remove_pointer_t< decltype( detail::to_address( std::declval< const P& >() ) ) > >;
+
+/**
+ * @brief Concept: P and Q can be compared by address: they point to the same
+ *        type (ignoring cv), or one of them points to void. A Derived* next to
+ *        a Base* is rejected, as the base subobject need not share the address
+ *        of the derived object (multiple inheritance).
+ */
+template < typename P, typename Q >
+concept address_comparable = address_like< P > && address_like< Q >
+                          && ( std::is_same_v< address_element_t< P >, address_element_t< Q > >
+                               || std::is_void_v< address_element_t< P > > || std::is_void_v< address_element_t< Q > > );
+
+/**
+ * @brief Concept: K can look up a key pointing to E: K points to E, to a type
+ *        derived from E, or either side is void.
+ */
+template < typename K, typename E >
+concept address_lookup_key = address_like< K >
+                          && ( std::is_void_v< E > || std::is_void_v< address_element_t< K > >
+                               || std::is_convertible_v< address_element_t< K >*, E* > );
+
+/**
+ * @brief Returns the address of p's pointee, seen as an E (void: as is). A
+ *        pointer to a derived class is adjusted to its E subobject.
+ */
+template < typename E, address_like P >
+constexpr const void* address_as( const P& p ) noexcept
+{
+    if constexpr ( fancy_pointer< P > && !requires { p.get(); } )
+        if ( p == nullptr )
+            return nullptr;
+    if constexpr ( std::is_void_v< E > || std::is_void_v< address_element_t< P > > )
+        return static_cast< const void* >( detail::to_address( p ) );
+    else
+        return static_cast< const E* >( detail::to_address( p ) );
+}
+
+template < address_like P >
+constexpr const void* address_of( const P& p ) noexcept
+{
+    return detail::address_as< void >( p );
+}
+
+template < typename T >
+constexpr const T& owner_of( const T& p ) noexcept
+{
+    return p;
+}
+
+template < typename T, typename P >
+constexpr const std::shared_ptr< T >& owner_of( const non_null< std::shared_ptr< T >, P >& p ) noexcept
+{
+    return p.underlying();
+}
+
+template < typename T >
+constexpr const std::weak_ptr< T >& owner_of( const non_null_weak_ptr< T >& p ) noexcept
+{
+    return p.underlying();
+}
+
+} // namespace detail
+
+/**
+ * @brief Transparent hash by pointee address.
+ *
+ * Accepts raw pointers, std::unique_ptr, std::shared_ptr, non_null and
+ * optional_non_null interchangeably, so containers keyed on a non_null wrapper
+ * can be queried with a raw T* without constructing a temporary wrapper (and,
+ * for shared_ptr, without touching the reference count).
+ *
+ * std::hash<non_null<T>> produces the same values. The hash is taken of the
+ * address as given, so a lookup must use a pointer to the key's element type:
+ * a Derived* may hash differently from the Base subobject of the same object.
+ * pointer_equal rejects such mixed lookups at compile time.
+ */
+struct pointer_hash
+{
+    using is_transparent = void;
+
+    template < detail::address_like P >
+    constexpr std::size_t operator()( const P& p ) const noexcept
+    {
+        return std::hash< const void* > {}( detail::address_of( p ) );
+    }
+};
+
+/**
+ * @brief Transparent equality by pointee address; companion of pointer_hash.
+ *        Both sides must point to the same type, or one of them to void.
+ */
+struct pointer_equal
+{
+    using is_transparent = void;
+
+    template < detail::address_like P, detail::address_like Q >
+        requires detail::address_comparable< P, Q >
+    constexpr bool operator()( const P& lhs, const Q& rhs ) const noexcept
+    {
+        return detail::address_of( lhs ) == detail::address_of( rhs );
+    }
+};
+
+/**
+ * @brief Transparent owner-based ordering; like std::owner_less<void>, but also
+ *        accepts non_null<std::shared_ptr> and non_null_weak_ptr.
+ */
+struct owner_less
+{
+    using is_transparent = void;
+
+    template < typename P, typename Q >
+    constexpr bool operator()( const P& lhs, const Q& rhs ) const noexcept
+        requires requires { detail::owner_of( lhs ).owner_before( detail::owner_of( rhs ) ); }
+    {
+        return detail::owner_of( lhs ).owner_before( detail::owner_of( rhs ) );
+    }
+};
+
+#if defined( __cpp_lib_smart_ptr_owner_equality ) && __cpp_lib_smart_ptr_owner_equality >= 202306L
+
+/**
+ * @brief Transparent owner-based hash (C++26); like std::owner_hash, but also
+ *        accepts non_null<std::shared_ptr> and non_null_weak_ptr.
+ */
+struct owner_hash
+{
+    using is_transparent = void;
+
+    template < typename P >
+    std::size_t operator()( const P& p ) const noexcept
+        requires requires { detail::owner_of( p ).owner_hash(); }
+    {
+        return detail::owner_of( p ).owner_hash();
+    }
+};
+
+/**
+ * @brief Transparent owner-based equality (C++26); like std::owner_equal, but also
+ *        accepts non_null<std::shared_ptr> and non_null_weak_ptr.
+ */
+struct owner_equal
+{
+    using is_transparent = void;
+
+    template < typename P, typename Q >
+    bool operator()( const P& lhs, const Q& rhs ) const noexcept
+        requires requires { detail::owner_of( lhs ).owner_equal( detail::owner_of( rhs ) ); }
+    {
+        return detail::owner_of( lhs ).owner_equal( detail::owner_of( rhs ) );
+    }
+};
+
+#endif // __cpp_lib_smart_ptr_owner_equality
+
+} // namespace nova
+
+/**
+ * @brief Hashes non_null through get(), consistent with nova::pointer_hash.
+ */
+template < typename T, typename P >
+struct std::hash< nova::non_null< T, P > >
+{
+    std::size_t operator()( const nova::non_null< T, P >& nn ) const noexcept
+    {
+        return nova::pointer_hash {}( nn );
+    }
+};
+
+/**
+ * @brief Hashes optional_non_null through get(), consistent with nova::pointer_hash.
+ */
+template < typename T >
+struct std::hash< nova::optional_non_null< T > >
+{
+    std::size_t operator()( const nova::optional_non_null< T >& opt ) const noexcept
+    {
+        return nova::pointer_hash {}( opt );
+    }
+};
+
+#include <nova/non_null/detail/epilogue.hpp>
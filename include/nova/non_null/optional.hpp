@@ -0,0 +1,301 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2026 Tim Blechmann
+
+#pragma once
+
+#include <nova/non_null/core.hpp>
+
+#include <new>
+#include <optional>
+
+#include <nova/non_null/detail/prologue.hpp>
+
+namespace nova {
+
+// =============================================================================
+// try_make_non_null
+// =============================================================================
+
+/**
+ * @brief Factory function that creates a std::optional<non_null<T>>.
+ * Returns std::nullopt if the pointer is null.
+ * @tparam Policy The contract policy of the resulting non_null.
+ * @param p The pointer to wrap.
+ * @return A std::optional containing the non_null wrapper if p is not null, otherwise std::nullopt.
+ */
+template < contract_policy Policy = contract_default, typename T >
+constexpr std::optional< non_null< std::decay_t< T >, Policy > > try_make_non_null( T&& p )
+{
+    if ( p == nullptr )
+        return std::nullopt;
+
+    // Already checked: the policy's check folds away.
+    return std::optional< non_null< std::decay_t< T >, Policy > >( std::in_place, std::forward< T >( p ) );
+}
+
+// =============================================================================
+// optional_non_null
+// =============================================================================
+
+/**
+ * @brief An optional non_null<T> that uses the null pointer as its empty state.
+ *
+ * Unlike std::optional<non_null<T>>, no separate engaged flag is stored, so
+ * sizeof(optional_non_null<T>) == sizeof(T) and has_value() simply tests the
+ * pointer. value() and operator* hand out non_null<T>, carrying the
+ * assume_nonnull hint into the caller.
+ *
+ * For move-only pointers (std::unique_ptr) the non_null<T> is moved out of an
+ * rvalue optional: `std::move(opt).value()`. Moving an optional_non_null leaves
+ * the source empty, which is a valid state.
+ *
+ * @tparam T The pointer type (e.g., T*, std::unique_ptr<T>, std::shared_ptr<T>).
+ */
+template < typename T >
+class optional_non_null
+{
+public:
+    using value_type   = non_null< T >;
+    using element_type = detail::element_type_t< T >;
+    using pointer      = element_type*;
+
+    static_assert( std::is_constructible_v< bool, T >,
+                   "T must be contextually convertible to bool (to check for null)" );
+
+    /**
+     * @brief Constructs an empty optional.
+     */
+    constexpr optional_non_null() noexcept = default;
+    constexpr optional_non_null( std::nullopt_t ) noexcept
+    {}
+    constexpr optional_non_null( std::nullptr_t ) noexcept
+    {}
+
+    /**
+     * @brief Constructs from a nullable pointer; the optional is empty if p is null.
+     */
+    template < typename U >
+        requires std::is_convertible_v< U, T > && (!std::is_same_v< std::remove_cvref_t< U >, std::nullptr_t >)
+    constexpr explicit optional_non_null( U&& p ) noexcept( std::is_nothrow_constructible_v< T, U > ) :
+        ptr_( std::forward< U >( p ) )
+    {}
+
+    /**
+     * @brief Constructs an engaged optional from a compatible non_null wrapper.
+     */
+    template < typename U, typename Q >
+        requires std::is_convertible_v< const U&, T >
+    constexpr optional_non_null( const non_null< U, Q >& nn ) noexcept :
+        ptr_( nn.underlying() )
+    {}
+
+    /**
+     * @brief Constructs an engaged optional by taking ownership out of a
+     *        move-only non_null wrapper (e.g. non_null<std::unique_ptr>).
+     */
+    template < typename U, typename Q >
+        requires std::is_convertible_v< U, T > && ( !detail::copyable_pointer< U > )
+    optional_non_null( non_null< U, Q >&& nn ) noexcept :
+        ptr_( take( std::move( nn ) ) )
+    {}
+
+    optional_non_null( const optional_non_null& )                = default;
+    optional_non_null( optional_non_null&& ) noexcept            = default;
+    optional_non_null& operator=( const optional_non_null& )     = default;
+    optional_non_null& operator=( optional_non_null&& ) noexcept = default;
+
+    constexpr optional_non_null& operator=( std::nullopt_t ) noexcept
+    {
+        reset();
+        return *this;
+    }
+
+    /**
+     * @brief Returns true if a pointer is held.
+     */
+    constexpr bool has_value() const noexcept
+    {
+        return ptr_ != nullptr;
+    }
+
+    constexpr explicit operator bool() const noexcept
+    {
+        return has_value();
+    }
+
+    /**
+     * @brief Returns the held pointer as non_null<T>.
+     * @throws std::bad_optional_access if the optional is empty.
+     */
+    constexpr non_null< T > value() const&
+        requires detail::copyable_pointer< T >
+    {
+        if ( !has_value() )
+            throw std::bad_optional_access();
+        return non_null< T >( ptr_ );
+    }
+
+    /**
+     * @brief Moves the held pointer out as non_null<T>, leaving the optional empty
+     *        for move-only pointer types.
+     * @throws std::bad_optional_access if the optional is empty.
+     */
+    constexpr non_null< T > value() &&
+    {
+        if ( !has_value() )
+            throw std::bad_optional_access();
+        return non_null< T >( std::move( ptr_ ) );
+    }
+
+    /**
+     * @brief Returns the held pointer as non_null<T>. The optional must not be empty.
+     */
+    constexpr non_null< T > operator*() const&
+        requires detail::copyable_pointer< T >
+    {
+        detail::assume_nonnull( ptr_ );
+        return non_null< T >( ptr_ );
+    }
+
+    constexpr non_null< T > operator*() &&
+    {
+        detail::assume_nonnull( ptr_ );
+        return non_null< T >( std::move( ptr_ ) );
+    }
+
+    /**
+     * @brief Accesses the members of the object pointed to. The optional must not be empty.
+     */
+    constexpr pointer NOVA_NONNULL operator->() const noexcept NOVA_RETURNS_NONNULL
+    {
+        detail::assume_nonnull( ptr_ );
+        pointer p = detail::to_address( ptr_ );
+        detail::assume_nonnull( p );
+        return p;
+    }
+
+    /**
+     * @brief Returns the raw pointer, or nullptr if the optional is empty.
+     */
+    constexpr pointer get() const noexcept
+    {
+        // std::to_address may dereference a fancy pointer; do not decode a null one.
+        if constexpr ( detail::fancy_pointer< T > && !requires { ptr_.get(); } )
+            if ( ptr_ == nullptr )
+                return nullptr;
+        return detail::to_address( ptr_ );
+    }
+
+    /**
+     * @brief Returns the underlying (nullable) pointer object.
+     */
+    constexpr const T& underlying() const& noexcept
+    {
+        return ptr_;
+    }
+
+    /**
+     * @brief Empties the optional, releasing the held pointer.
+     */
+    constexpr void reset() noexcept
+    {
+        ptr_ = nullptr;
+    }
+
+    constexpr void swap( optional_non_null& other ) noexcept
+    {
+        using std::swap;
+        swap( ptr_, other.ptr_ );
+    }
+
+    template < typename U >
+    friend constexpr bool operator==( const optional_non_null& lhs, const optional_non_null< U >& rhs ) noexcept
+    {
+        return lhs.get() == rhs.get();
+    }
+
+    friend constexpr bool operator==( const optional_non_null& lhs, std::nullopt_t ) noexcept
+    {
+        return !lhs.has_value();
+    }
+
+private:
+    T ptr_ {};
+};
+
+template < typename T, typename P >
+optional_non_null( non_null< T, P > ) -> optional_non_null< T >;
+
+template < typename T >
+optional_non_null( T* ) -> optional_non_null< T* >;
+
+template < typename T, typename D >
+optional_non_null( std::unique_ptr< T, D > ) -> optional_non_null< std::unique_ptr< T, D > >;
+
+template < typename T >
+optional_non_null( std::shared_ptr< T > ) -> optional_non_null< std::shared_ptr< T > >;
+
+template < detail::fancy_pointer P >
+optional_non_null( P ) -> optional_non_null< P >;
+
+/**
+ * @brief ADL swap for optional_non_null.
+ */
+template < typename T >
+constexpr void swap( optional_non_null< T >& lhs, optional_non_null< T >& rhs ) noexcept
+{
+    lhs.swap( rhs );
+}
+
+/**
+ * @brief Factory function that creates an optional_non_null<T>.
+ * Like try_make_non_null, but returns a pointer-sized optional that is empty if p is null.
+ * @param p The pointer to wrap.
+ */
+template < typename T >
+constexpr optional_non_null< std::decay_t< T > > try_make_optional_non_null( T&& p )
+{
+    return optional_non_null< std::decay_t< T > >( std::forward< T >( p ) );
+}
+
+/**
+ * @brief Factory function that creates an optional_non_null<std::unique_ptr<T>>.
+ * Like make_non_null_unique, but allocates with nothrow new and returns an empty
+ * optional if the allocation fails.
+ * @tparam T The type to construct.
+ * @param args Arguments to forward to T's constructor.
+ */
+template < typename T, typename... Args >
+inline optional_non_null< std::unique_ptr< T > > try_make_non_null_unique( Args&&... args )
+{
+    return optional_non_null< std::unique_ptr< T > >(
+        std::unique_ptr< T >( new ( std::nothrow ) T( std::forward< Args >( args )... ) ) );
+}
+
+/**
+ * @brief Factory function that creates an optional_non_null<std::shared_ptr<T>>.
+ * Like make_non_null_shared, but returns an empty optional if the allocation fails.
+ * @tparam T The type to construct.
+ * @param args Arguments to forward to T's constructor.
+ */
+template < typename T, typename... Args >
+inline optional_non_null< std::shared_ptr< T > > try_make_non_null_shared( Args&&... args )
+{
+#if defined( __cpp_exceptions )
+    try {
+        return optional_non_null< std::shared_ptr< T > >( std::make_shared< T >( std::forward< Args >( args )... ) );
+    } catch ( const std::bad_alloc& ) {
+        return std::nullopt;
+    }
+#else
+    return optional_non_null< std::shared_ptr< T > >( std::make_shared< T >( std::forward< Args >( args )... ) );
+#endif
+}
+
+template < typename T >
+struct is_trivially_relocatable< optional_non_null< T > > : is_trivially_relocatable< T >
+{};
+
+} // namespace nova
+
+#include <nova/non_null/detail/epilogue.hpp>
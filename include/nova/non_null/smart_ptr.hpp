@@ -0,0 +1,1168 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2026 Tim Blechmann
+
+#pragma once
+
+#include <nova/non_null/allocator.hpp>
+#include <nova/non_null/optional.hpp>
+
+#include <nova/non_null/detail/prologue.hpp>
+
+namespace nova {
+
+// =============================================================================
+// intrusive_ptr
+// =============================================================================
+
+/**
+ * @brief Reference count policy: atomic counter, safe to share across threads.
+ */
+struct intrusive_thread_safe_counter
+{
+    using type = std::atomic< std::size_t >;
+
+    static void increment( type& count ) noexcept
+    {
+        count.fetch_add( 1, std::memory_order_relaxed );
+    }
+
+    // Returns true when the last reference was released.
+    static bool decrement( type& count ) noexcept
+    {
+        return count.fetch_sub( 1, std::memory_order_acq_rel ) == 1;
+    }
+
+    static std::size_t load( const type& count ) noexcept
+    {
+        return count.load( std::memory_order_relaxed );
+    }
+};
+
+/**
+ * @brief Reference count policy: plain counter for objects confined to one
+ *        thread (e.g. per-shard data). Avoids the atomic read-modify-writes.
+ */
+struct intrusive_thread_unsafe_counter
+{
+    using type = std::size_t;
+
+    static void increment( type& count ) noexcept
+    {
+        ++count;
+    }
+
+    static bool decrement( type& count ) noexcept
+    {
+        return --count == 0;
+    }
+
+    static std::size_t load( const type& count ) noexcept
+    {
+        return count;
+    }
+};
+
+/**
+ * @brief CRTP base that embeds a reference count in Derived.
+ *
+ * Provides the intrusive_ptr_add_ref / intrusive_ptr_release customisation
+ * points used by intrusive_ptr; the object is deleted through Derived when the
+ * last reference is released. Types with their own counting scheme can instead
+ * provide these two functions, found via ADL:
+ *
+ *   void intrusive_ptr_add_ref( const T* ) noexcept;
+ *   void intrusive_ptr_release( const T* ) noexcept;
+ *
+ * @tparam Derived       The refcounted type.
+ * @tparam CounterPolicy intrusive_thread_safe_counter or intrusive_thread_unsafe_counter.
+ */
+template < typename Derived, typename CounterPolicy = intrusive_thread_safe_counter >
+class intrusive_ref_counter
+{
+public:
+    /**
+     * @brief Returns the current number of references (a snapshot for the
+     *        thread-safe policy).
+     */
+    std::size_t use_count() const noexcept
+    {
+        return CounterPolicy::load( count_ );
+    }
+
+protected:
+    intrusive_ref_counter() noexcept = default;
+
+    // Copies are new objects: the reference count is not copied.
+    intrusive_ref_counter( const intrusive_ref_counter& ) noexcept
+    {}
+    intrusive_ref_counter& operator=( const intrusive_ref_counter& ) noexcept
+    {
+        return *this;
+    }
+
+    ~intrusive_ref_counter() = default;
+
+private:
+    friend void intrusive_ptr_add_ref( const intrusive_ref_counter* NOVA_NONNULL p ) noexcept
+    {
+        CounterPolicy::increment( p->count_ );
+    }
+
+    friend void intrusive_ptr_release( const intrusive_ref_counter* NOVA_NONNULL p ) noexcept
+    {
+        if ( CounterPolicy::decrement( p->count_ ) )
+            delete static_cast< const Derived* >( p );
+    }
+
+    mutable typename CounterPolicy::type count_ { 0 };
+};
+
+/**
+ * @brief A nullable, one-word smart pointer to an intrusively refcounted T.
+ *
+ * Unlike std::shared_ptr there is no separate control block and no weak
+ * count. Reference counting goes through the intrusive_ptr_add_ref /
+ * intrusive_ptr_release customisation points (see intrusive_ref_counter).
+ * Use non_null_intrusive_ptr<T> for the never-null form.
+ */
+template < typename T >
+class intrusive_ptr
+{
+public:
+    using element_type = T;
+
+    template < typename >
+    friend class intrusive_ptr;
+
+    constexpr intrusive_ptr() noexcept = default;
+    constexpr intrusive_ptr( std::nullptr_t ) noexcept
+    {}
+
+    /**
+     * @brief Takes a reference to p (or adopts an existing one if add_ref is false).
+     */
+    explicit intrusive_ptr( T* p, bool add_ref = true ) noexcept :
+        ptr_( p )
+    {
+        if ( ptr_ && add_ref )
+            intrusive_ptr_add_ref( ptr_ );
+    }
+
+    intrusive_ptr( const intrusive_ptr& other ) noexcept :
+        intrusive_ptr( other.ptr_ )
+    {}
+
+    template < typename U >
+        requires std::is_convertible_v< U*, T* >
+    intrusive_ptr( const intrusive_ptr< U >& other ) noexcept :
+        intrusive_ptr( other.ptr_ )
+    {}
+
+    intrusive_ptr( intrusive_ptr&& other ) noexcept :
+        ptr_( std::exchange( other.ptr_, nullptr ) )
+    {}
+
+    template < typename U >
+        requires std::is_convertible_v< U*, T* >
+    intrusive_ptr( intrusive_ptr< U >&& other ) noexcept :
+        ptr_( std::exchange( other.ptr_, nullptr ) )
+    {}
+
+    ~intrusive_ptr()
+    {
+        if ( ptr_ )
+            intrusive_ptr_release( ptr_ );
+    }
+
+    intrusive_ptr& operator=( const intrusive_ptr& other ) noexcept
+    {
+        intrusive_ptr( other ).swap( *this );
+        return *this;
+    }
+
+    intrusive_ptr& operator=( intrusive_ptr&& other ) noexcept
+    {
+        intrusive_ptr( std::move( other ) ).swap( *this );
+        return *this;
+    }
+
+    intrusive_ptr& operator=( std::nullptr_t ) noexcept
+    {
+        reset();
+        return *this;
+    }
+
+    void reset() noexcept
+    {
+        intrusive_ptr().swap( *this );
+    }
+
+    /**
+     * @brief Releases ownership of the reference without decrementing the count.
+     */
+    T* detach() noexcept
+    {
+        return std::exchange( ptr_, nullptr );
+    }
+
+    void swap( intrusive_ptr& other ) noexcept
+    {
+        std::swap( ptr_, other.ptr_ );
+    }
+
+    T* get() const noexcept
+    {
+        return ptr_;
+    }
+
+    T* operator->() const noexcept
+    {
+        assert( ptr_ && "nova::intrusive_ptr: dereferencing null pointer" );
+        return ptr_;
+    }
+
+    T& operator*() const noexcept
+    {
+        assert( ptr_ && "nova::intrusive_ptr: dereferencing null pointer" );
+        return *ptr_;
+    }
+
+    explicit operator bool() const noexcept
+    {
+        return ptr_ != nullptr;
+    }
+
+    template < typename U >
+    friend bool operator==( const intrusive_ptr& lhs, const intrusive_ptr< U >& rhs ) noexcept
+    {
+        return lhs.get() == rhs.get();
+    }
+
+    template < typename U >
+    friend auto operator<=>( const intrusive_ptr& lhs, const intrusive_ptr< U >& rhs ) noexcept
+    {
+        return lhs.get() <=> rhs.get();
+    }
+
+    friend bool operator==( const intrusive_ptr& lhs, std::nullptr_t ) noexcept
+    {
+        return lhs.get() == nullptr;
+    }
+
+private:
+    T* ptr_ = nullptr;
+};
+
+/**
+ * @brief Swaps two intrusive_ptr objects (found via ADL).
+ */
+template < typename T >
+void swap( intrusive_ptr< T >& lhs, intrusive_ptr< T >& rhs ) noexcept
+{
+    lhs.swap( rhs );
+}
+
+template < typename T >
+non_null( intrusive_ptr< T > NOVA_NONNULL_NONTRIVIAL ) -> non_null< intrusive_ptr< T > >;
+
+/**
+ * @brief A never-null, one-word intrusive smart pointer.
+ * Copyable: copy and move behave like non_null_shared_ptr.
+ */
+template < typename T >
+using non_null_intrusive_ptr = non_null< intrusive_ptr< T > >;
+
+/**
+ * @brief Factory function that creates a non_null_intrusive_ptr<T>.
+ * Similar to make_non_null_shared, but the count lives inside T.
+ * @tparam T The type to construct; must provide the intrusive_ptr customisation points.
+ * @tparam Args The argument types for T's constructor.
+ * @param args Arguments to forward to T's constructor.
+ * @return A non_null_intrusive_ptr<T> holding the only reference.
+ */
+template < typename T, typename... Args >
+inline non_null_intrusive_ptr< T > make_non_null_intrusive( Args&&... args )
+{
+    return non_null( intrusive_ptr< T >( new T( std::forward< Args >( args )... ) ) );
+}
+
+template < typename T >
+struct is_trivially_relocatable< intrusive_ptr< T > > : std::true_type
+{};
+
+// =============================================================================
+// non_null_weak_ptr
+// =============================================================================
+
+/**
+ * @brief Weak companion of non_null_shared_ptr.
+ *
+ * Constructed only from a non_null<std::shared_ptr>, so it always refers to
+ * an owner; the owner may have expired. lock() promotes in a single step to
+ * an optional_non_null<std::shared_ptr<T>>: one null check, and the result is
+ * no larger than a std::shared_ptr.
+ *
+ * Like non_null<std::shared_ptr>, move is emulated by copy, so a moved-from
+ * non_null_weak_ptr still refers to its owner.
+ *
+ * @tparam T The element type.
+ */
+template < typename T >
+class non_null_weak_ptr
+{
+public:
+    using element_type = T;
+    using weak_type    = std::weak_ptr< T >;
+
+    template < typename U, typename Q >
+        requires std::is_convertible_v< U*, T* >
+    non_null_weak_ptr( const non_null< std::shared_ptr< U >, Q >& owner ) noexcept :
+        weak_( owner.underlying() )
+    {}
+
+    template < typename U >
+        requires std::is_convertible_v< U*, T* >
+    non_null_weak_ptr( const non_null_weak_ptr< U >& other ) noexcept :
+        weak_( other.underlying() )
+    {}
+
+    non_null_weak_ptr( const non_null_weak_ptr& ) noexcept = default;
+    non_null_weak_ptr( non_null_weak_ptr&& other ) noexcept :
+        weak_( other.weak_ )
+    {}
+
+    non_null_weak_ptr& operator=( const non_null_weak_ptr& ) noexcept = default;
+    non_null_weak_ptr& operator=( non_null_weak_ptr&& other ) noexcept
+    {
+        weak_ = other.weak_;
+        return *this;
+    }
+
+    template < typename U, typename Q >
+        requires std::is_convertible_v< U*, T* >
+    non_null_weak_ptr& operator=( const non_null< std::shared_ptr< U >, Q >& owner ) noexcept
+    {
+        weak_ = owner.underlying();
+        return *this;
+    }
+
+    non_null_weak_ptr( std::nullptr_t )            = delete;
+    non_null_weak_ptr& operator=( std::nullptr_t ) = delete;
+
+    /**
+     * @brief Promotes to a strong reference.
+     * @return An engaged optional_non_null if the owner is alive, empty otherwise.
+     */
+    optional_non_null< std::shared_ptr< T > > lock() const noexcept
+    {
+        return optional_non_null< std::shared_ptr< T > >( weak_.lock() );
+    }
+
+    bool expired() const noexcept
+    {
+        return weak_.expired();
+    }
+
+    long use_count() const noexcept
+    {
+        return weak_.use_count();
+    }
+
+    /**
+     * @brief Returns the underlying std::weak_ptr.
+     */
+    const weak_type& underlying() const& noexcept
+    {
+        return weak_;
+    }
+
+    /**
+     * @brief Owner-based ordering; consistent with std::owner_less.
+     */
+    template < typename Y >
+    bool owner_before( const non_null_weak_ptr< Y >& other ) const noexcept
+    {
+        return weak_.owner_before( other.underlying() );
+    }
+
+    template < typename Y, typename Q >
+    bool owner_before( const non_null< std::shared_ptr< Y >, Q >& other ) const noexcept
+    {
+        return weak_.owner_before( other.underlying() );
+    }
+
+    template < typename Y >
+    bool owner_before( const std::shared_ptr< Y >& other ) const noexcept
+    {
+        return weak_.owner_before( other );
+    }
+
+    template < typename Y >
+    bool owner_before( const std::weak_ptr< Y >& other ) const noexcept
+    {
+        return weak_.owner_before( other );
+    }
+
+#if defined( __cpp_lib_smart_ptr_owner_equality ) && __cpp_lib_smart_ptr_owner_equality >= 202306L
+    /**
+     * @brief Owner-based hashing and equal comparison (C++26).
+     */
+    std::size_t owner_hash() const noexcept
+    {
+        return weak_.owner_hash();
+    }
+
+    template < typename Y >
+    bool owner_equal( const non_null_weak_ptr< Y >& other ) const noexcept
+    {
+        return weak_.owner_equal( other.underlying() );
+    }
+
+    template < typename Y, typename Q >
+    bool owner_equal( const non_null< std::shared_ptr< Y >, Q >& other ) const noexcept
+    {
+        return weak_.owner_equal( other.underlying() );
+    }
+
+    template < typename Y >
+    bool owner_equal( const std::shared_ptr< Y >& other ) const noexcept
+    {
+        return weak_.owner_equal( other );
+    }
+
+    template < typename Y >
+    bool owner_equal( const std::weak_ptr< Y >& other ) const noexcept
+    {
+        return weak_.owner_equal( other );
+    }
+#endif
+
+    void swap( non_null_weak_ptr& other ) noexcept
+    {
+        weak_.swap( other.weak_ );
+    }
+
+private:
+    weak_type weak_;
+};
+
+template < typename T, typename P >
+non_null_weak_ptr( non_null< std::shared_ptr< T >, P > ) -> non_null_weak_ptr< T >;
+
+/**
+ * @brief ADL swap for non_null_weak_ptr.
+ */
+template < typename T >
+void swap( non_null_weak_ptr< T >& lhs, non_null_weak_ptr< T >& rhs ) noexcept
+{
+    lhs.swap( rhs );
+}
+
+template < typename T >
+struct is_trivially_relocatable< non_null_weak_ptr< T > > : std::true_type
+{};
+
+// =============================================================================
+// non_null_trivial_unique_ptr
+// =============================================================================
+
+/**
+ * @brief An owning non-null pointer with a register-passable ABI.
+ *
+ * non_null<std::unique_ptr<T>> is non-trivial for the purpose of calls, so it
+ * is passed and returned through memory. This type stores the raw pointer and
+ * the deleter directly and is marked [[clang::trivial_abi]] where supported:
+ * with an empty deleter it travels in a single register, and the callee
+ * destroys by-value parameters.
+ *
+ * trivial_abi requires an accessible move constructor, so unlike
+ * non_null<std::unique_ptr<T>> this type is movable. A move has the semantics
+ * of take(): the source is left taken (poisoned in ASAN builds) and may only be
+ * destroyed or assigned to. take() returns the std::unique_ptr<T, D>.
+ *
+ * @tparam T The pointee type (arrays are not supported).
+ * @tparam D The deleter. Must be nothrow move constructible.
+ */
+template < typename T, typename D = std::default_delete< T > >
+class NOVA_TRIVIAL_ABI non_null_trivial_unique_ptr
+{
+public:
+    using element_type = T;
+    using pointer      = T*;
+    using deleter_type = D;
+
+    template < typename, typename >
+    friend class non_null_trivial_unique_ptr;
+
+    static_assert( !std::is_array_v< T >, "nova::non_null_trivial_unique_ptr: arrays are not supported" );
+    static_assert( std::is_nothrow_move_constructible_v< D >,
+                   "nova::non_null_trivial_unique_ptr: deleter must be nothrow move constructible" );
+
+    /**
+     * @brief Takes ownership of p, which must not be null.
+     */
+    constexpr explicit non_null_trivial_unique_ptr( pointer NOVA_NONNULL p ) noexcept
+        requires std::is_default_constructible_v< D >
+        :
+        ptr_( p )
+    {
+        detail::assume_nonnull( ptr_ );
+    }
+
+    constexpr non_null_trivial_unique_ptr( pointer NOVA_NONNULL p, D d ) noexcept :
+        ptr_( p ),
+        deleter_( std::move( d ) )
+    {
+        detail::assume_nonnull( ptr_ );
+    }
+
+    /**
+     * @brief Takes ownership out of a std::unique_ptr, which must not be null.
+     */
+    template < typename U, typename E >
+        requires std::is_convertible_v< U*, T* > && std::is_constructible_v< D, E&& >
+    constexpr explicit non_null_trivial_unique_ptr( std::unique_ptr< U, E >&& up ) noexcept :
+        ptr_( up.get() ),
+        deleter_( std::move( up.get_deleter() ) )
+    {
+        detail::assume_nonnull( ptr_ );
+        up.release();
+    }
+
+    /**
+     * @brief Takes ownership out of a non_null<std::unique_ptr> via take().
+     */
+    template < typename U, typename E, typename Q >
+        requires std::is_convertible_v< U*, T* > && std::is_constructible_v< D, E&& >
+    explicit non_null_trivial_unique_ptr( non_null< std::unique_ptr< U, E >, Q >&& nn ) noexcept :
+        non_null_trivial_unique_ptr( take( std::move( nn ) ) )
+    {}
+
+    /**
+     * @brief Move constructor with take() semantics: other is left taken.
+     */
+    constexpr non_null_trivial_unique_ptr( non_null_trivial_unique_ptr&& other ) noexcept :
+        ptr_( other.release_taken() ),
+        deleter_( std::move( other.deleter_ ) )
+    {}
+
+    template < typename U, typename E >
+        requires std::is_convertible_v< U*, T* > && std::is_constructible_v< D, E&& >
+    constexpr non_null_trivial_unique_ptr( non_null_trivial_unique_ptr< U, E >&& other ) noexcept :
+        ptr_( other.release_taken() ),
+        deleter_( std::move( other.deleter_ ) )
+    {}
+
+    /**
+     * @brief Destroys the owned object, then takes ownership from other.
+     *        other is left taken. This object may itself be taken.
+     */
+    constexpr non_null_trivial_unique_ptr& operator=( non_null_trivial_unique_ptr&& other ) noexcept
+    {
+        if ( this != &other ) {
+            reset_taken();
+            ptr_     = other.release_taken();
+            deleter_ = std::move( other.deleter_ );
+        }
+        return *this;
+    }
+
+    non_null_trivial_unique_ptr( const non_null_trivial_unique_ptr& )            = delete;
+    non_null_trivial_unique_ptr& operator=( const non_null_trivial_unique_ptr& ) = delete;
+
+    // Disable null construction and null assignment
+    non_null_trivial_unique_ptr( std::nullptr_t )            = delete;
+    non_null_trivial_unique_ptr& operator=( std::nullptr_t ) = delete;
+
+    constexpr ~non_null_trivial_unique_ptr()
+    {
+        reset_taken();
+    }
+
+    /**
+     * @brief Extracts ownership as std::unique_ptr<T, D>, consuming the wrapper.
+     *
+     * After this call the wrapper is taken and must not be used (it will be
+     * destroyed normally, but accessing it is undefined behaviour).
+     */
+    friend constexpr std::unique_ptr< T, D > NOVA_NONNULL_NONTRIVIAL take( non_null_trivial_unique_ptr&& nn ) noexcept
+    {
+        D       d = std::move( nn.deleter_ );
+        pointer p = nn.release_taken();
+        detail::assume_nonnull( p );
+        return std::unique_ptr< T, D >( p, std::move( d ) );
+    }
+
+    /**
+     * @brief Swaps the managed pointers and deleters.
+     * Both objects remain non-null after the swap.
+     */
+    constexpr void swap( non_null_trivial_unique_ptr& other ) noexcept
+    {
+        detail::nova_asan_unpoison( &ptr_, sizeof( ptr_ ) );
+        detail::nova_asan_unpoison( &other.ptr_, sizeof( other.ptr_ ) );
+        using std::swap;
+        swap( ptr_, other.ptr_ );
+        swap( deleter_, other.deleter_ );
+    }
+
+    constexpr pointer NOVA_NONNULL get() const noexcept NOVA_RETURNS_NONNULL
+    {
+        detail::assume_nonnull( ptr_ );
+        return ptr_;
+    }
+
+    constexpr pointer NOVA_NONNULL operator->() const noexcept NOVA_RETURNS_NONNULL
+    {
+        return get();
+    }
+
+    constexpr T& operator*() const noexcept
+    {
+        return *get();
+    }
+
+    /**
+     * @brief Returns a non-owning non_null<T*> that must not outlive this
+     *        pointer (lifetimebound).
+     */
+    constexpr non_null< pointer > borrow() const& noexcept NOVA_LIFETIMEBOUND
+    {
+        return non_null< pointer >( get() );
+    }
+
+    non_null< pointer > borrow() && noexcept = delete;
+
+    /**
+     * @brief Always returns true as non_null objects are guaranteed to be non-null.
+     */
+    constexpr explicit operator bool() const noexcept
+    {
+        return true;
+    }
+
+    constexpr D& get_deleter() noexcept
+    {
+        return deleter_;
+    }
+
+    constexpr const D& get_deleter() const noexcept
+    {
+        return deleter_;
+    }
+
+    template < typename U, typename E >
+    friend constexpr bool operator==( const non_null_trivial_unique_ptr& lhs,
+                                      const non_null_trivial_unique_ptr< U, E >& rhs ) noexcept
+    {
+        return lhs.get() == rhs.get();
+    }
+
+    template < typename U, typename E >
+    friend constexpr auto operator<=>( const non_null_trivial_unique_ptr& lhs,
+                                       const non_null_trivial_unique_ptr< U, E >& rhs ) noexcept
+    {
+        return lhs.get() <=> rhs.get();
+    }
+
+    friend constexpr bool operator==( const non_null_trivial_unique_ptr&, std::nullptr_t ) noexcept
+    {
+        return false;
+    }
+
+private:
+    // Nulls ptr_ and poisons it, returning the previous value.
+    constexpr pointer release_taken() noexcept
+    {
+        detail::nova_asan_unpoison( &ptr_, sizeof( ptr_ ) );
+        pointer p = std::exchange( ptr_, nullptr );
+        detail::nova_asan_poison( &ptr_, sizeof( ptr_ ) );
+        return p;
+    }
+
+    // Deletes the owned object unless taken, leaving ptr_ unpoisoned and null.
+    constexpr void reset_taken() noexcept
+    {
+        detail::nova_asan_unpoison( &ptr_, sizeof( ptr_ ) );
+        if ( pointer p = std::exchange( ptr_, nullptr ) )
+            deleter_( p );
+    }
+
+    pointer                 ptr_;
+    [[no_unique_address]] D deleter_ {};
+};
+
+template < typename T, typename D >
+non_null_trivial_unique_ptr( std::unique_ptr< T, D > ) -> non_null_trivial_unique_ptr< T, D >;
+
+template < typename T, typename D, typename P >
+non_null_trivial_unique_ptr( non_null< std::unique_ptr< T, D >, P > ) -> non_null_trivial_unique_ptr< T, D >;
+
+/**
+ * @brief Swaps two non_null_trivial_unique_ptr objects (found via ADL).
+ */
+template < typename T, typename D >
+void swap( non_null_trivial_unique_ptr< T, D >& lhs, non_null_trivial_unique_ptr< T, D >& rhs ) noexcept
+{
+    lhs.swap( rhs );
+}
+
+template < typename T, typename D >
+struct is_trivially_relocatable< non_null_trivial_unique_ptr< T, D > > : is_trivially_relocatable< D >
+{};
+
+/**
+ * @brief Factory function that creates a non_null_trivial_unique_ptr<T>.
+ * Similar to std::make_unique, but returns a register-passable non-null wrapper.
+ */
+template < typename T, typename... Args >
+inline non_null_trivial_unique_ptr< T > make_non_null_trivial_unique( Args&&... args )
+{
+    return non_null_trivial_unique_ptr< T >( std::make_unique< T >( std::forward< Args >( args )... ) );
+}
+
+// =============================================================================
+// non_null_box
+// =============================================================================
+
+namespace detail {
+
+/**
+ * @brief Type-erased operations on the object owned by a non_null_box<T>.
+ * copy is null if the dynamic type is not copy constructible.
+ */
+template < typename T >
+struct box_ops
+{
+    using copy_function = T* ( * )( const T& src, void* buffer );
+
+    copy_function copy;
+    T* ( *move )( T& src, void* buffer );
+    void ( *destroy )( T* p ) noexcept;
+    bool stored_inline;
+};
+
+template < typename U, std::size_t Capacity >
+inline constexpr bool box_stores_inline = sizeof( U ) <= Capacity && alignof( U ) <= alignof( std::max_align_t )
+                                       && std::is_nothrow_move_constructible_v< U >;
+
+template < typename T, typename U, std::size_t Capacity >
+struct box_ops_for
+{
+    static constexpr bool stored_inline = box_stores_inline< U, Capacity >;
+
+    template < typename... Args >
+    static T* create( void* buffer, Args&&... args )
+    {
+        if constexpr ( stored_inline )
+            return ::new ( buffer ) U( std::forward< Args >( args )... );
+        else
+            return new U( std::forward< Args >( args )... );
+    }
+
+    static T* copy( const T& src, void* buffer )
+    {
+        return create( buffer, static_cast< const U& >( src ) );
+    }
+
+    static T* move( T& src, void* buffer )
+    {
+        return create( buffer, std::move( static_cast< U& >( src ) ) );
+    }
+
+    static void destroy( T* p ) noexcept
+    {
+        if constexpr ( stored_inline )
+            static_cast< U* >( p )->~U();
+        else
+            delete static_cast< U* >( p );
+    }
+
+    static constexpr typename box_ops< T >::copy_function copy_or_null() noexcept
+    {
+        if constexpr ( std::is_copy_constructible_v< U > )
+            return &copy;
+        else
+            return nullptr;
+    }
+
+    static constexpr box_ops< T > table {
+        copy_or_null(),
+        &move,
+        &destroy,
+        stored_inline,
+    };
+};
+
+template < std::size_t Capacity >
+struct box_buffer
+{
+    alignas( std::max_align_t ) std::byte bytes[ Capacity ];
+
+    void* get() noexcept
+    {
+        return bytes;
+    }
+};
+
+template <>
+struct box_buffer< 0 >
+{
+    void* get() noexcept
+    {
+        return nullptr;
+    }
+};
+
+} // namespace detail
+
+/**
+ * @brief A never-null owning holder of a T with value semantics, in the style of
+ *        std::indirect and std::polymorphic (C++26).
+ *
+ * Copying a box deep-copies the owned object, including its dynamic type when
+ * the box was constructed with std::in_place_type<U> for a U derived from T.
+ * Objects of up to Capacity bytes that are nothrow move constructible are kept
+ * in an inline buffer; larger ones are allocated with new.
+ *
+ * Unlike std::indirect, a box is never valueless, and unlike
+ * non_null_unique_ptr it can be moved:
+ * - An inline object is move-constructed into the target; the source keeps
+ *   the moved-from object.
+ * - A heap object is stolen, so the move does not allocate. Const access to
+ *   the source reads a shared, const, value-initialised sentinel T. The first
+ *   non-const access gives the source a value-initialised T of its own (inline
+ *   if it fits, otherwise allocated), so writing through a moved-from box is
+ *   well-defined; only then may the non-const accessors throw.
+ * - If T is not nothrow default constructible (e.g. abstract), there is no
+ *   sentinel: the object is move-constructed into a new allocation instead.
+ *
+ * The accessors carry the same non-null hints as non_null::get(). Access is
+ * const-propagating.
+ *
+ * @tparam T        The object type; may be abstract when only derived types are stored.
+ * @tparam Capacity Size of the inline buffer in bytes; 0 (the default) always allocates.
+ */
+template < typename T, std::size_t Capacity = 0 >
+class non_null_box
+{
+    static_assert( std::is_object_v< T > && !std::is_array_v< T > && !std::is_const_v< T >,
+                   "nova::non_null_box: T must be a non-const, non-array object type" );
+
+    template < typename U >
+    using ops_for = detail::box_ops_for< T, U, Capacity >;
+
+    static constexpr bool has_sentinel  = std::is_nothrow_default_constructible_v< T >;
+    // Non-const access to a moved-from box may allocate its own T.
+    static constexpr bool nothrow_access = !has_sentinel || ops_for< T >::stored_inline;
+    static constexpr bool copyable_type = std::is_copy_constructible_v< T > || std::is_abstract_v< T >;
+
+    struct adopt_tag
+    {};
+
+    template < typename U >
+    using value_type_for = std::conditional_t< std::is_class_v< T > && std::derived_from< std::remove_cvref_t< U >, T >,
+                                               std::remove_cvref_t< U >,
+                                               T >;
+
+public:
+    using element_type  = T;
+    using pointer       = T*;
+    using const_pointer = const T*;
+
+    static constexpr std::size_t capacity = Capacity;
+
+    /**
+     * @brief Owns a value-initialised T.
+     */
+    explicit non_null_box()
+        requires std::is_default_constructible_v< T >
+        :
+        non_null_box( std::in_place )
+    {}
+
+    /**
+     * @brief Owns a T constructed from args.
+     */
+    template < typename... Args >
+        requires std::is_constructible_v< T, Args... >
+    explicit non_null_box( std::in_place_t, Args&&... args ) :
+        ptr_( ops_for< T >::create( buffer_.get(), std::forward< Args >( args )... ) ),
+        ops_( &ops_for< T >::table )
+    {}
+
+    /**
+     * @brief Owns a U, derived from T, constructed from args. Copies of the box
+     *        copy the U.
+     */
+    template < typename U, typename... Args >
+        requires( std::is_same_v< U, T > || std::derived_from< U, T > ) && std::is_constructible_v< U, Args... >
+    explicit non_null_box( std::in_place_type_t< U >, Args&&... args ) :
+        ptr_( ops_for< U >::create( buffer_.get(), std::forward< Args >( args )... ) ),
+        ops_( &ops_for< U >::table )
+    {
+        static_assert( !copyable_type || std::is_copy_constructible_v< U >,
+                       "nova::non_null_box: the stored type of a copyable box must be copy constructible" );
+    }
+
+    /**
+     * @brief Owns a copy of value: a T constructed from it, or, if value is of
+     *        a class derived from T, an object of that class.
+     */
+    template < typename U >
+        requires( !std::is_same_v< std::remove_cvref_t< U >, non_null_box > )
+                && (!std::is_same_v< std::remove_cvref_t< U >, std::in_place_t >)
+                && (!std::is_same_v< std::remove_cvref_t< U >, std::nullptr_t >)
+                && std::is_constructible_v< value_type_for< U >, U >
+    explicit non_null_box( U&& value ) :
+        non_null_box( std::in_place_type< value_type_for< U > >, std::forward< U >( value ) )
+    {}
+
+    /**
+     * @brief Deep copy.
+     */
+    non_null_box( const non_null_box& other )
+        requires copyable_type
+    {
+        const detail::box_ops< T >* ops = other.ops_ ? other.ops_ : sentinel_ops();
+        ptr_                            = ops->copy( *other.ptr_, buffer_.get() );
+        ops_                            = ops;
+    }
+
+    /**
+     * @brief Moves the owned object; other stays non-null (see the class
+     *        documentation). Allocates only if T has no sentinel.
+     */
+    non_null_box( non_null_box&& other ) noexcept( has_sentinel )
+    {
+        if constexpr ( has_sentinel ) {
+            take_from( other );
+            if ( !other.ops_ )
+                other.ptr_ = sentinel();
+        } else if ( other.stored_inline() ) {
+            take_from( other );
+        } else {
+            ptr_ = other.ops_->move( *other.ptr_, buffer_.get() );
+            ops_ = other.ops_;
+        }
+    }
+
+    non_null_box& operator=( const non_null_box& other )
+        requires copyable_type
+    {
+        if ( this != &other ) {
+            non_null_box tmp( other );
+            adopt( tmp );
+        }
+        return *this;
+    }
+
+    non_null_box& operator=( non_null_box&& other ) noexcept( has_sentinel )
+    {
+        if ( this != &other ) {
+            if constexpr ( has_sentinel ) {
+                adopt( other );
+                if ( !other.ops_ )
+                    other.ptr_ = sentinel();
+            } else {
+                non_null_box tmp( std::move( other ) );
+                adopt( tmp );
+            }
+        }
+        return *this;
+    }
+
+    // Prevent null construction and null assignment
+    non_null_box( std::nullptr_t )            = delete;
+    non_null_box& operator=( std::nullptr_t ) = delete;
+
+    ~non_null_box()
+    {
+        destroy();
+    }
+
+    /**
+     * @brief Returns a pointer to the owned object.
+     */
+    T* NOVA_NONNULL get() noexcept( nothrow_access ) NOVA_RETURNS_NONNULL
+    {
+        if constexpr ( has_sentinel )
+            if ( !ops_ ) [[unlikely]]
+                materialise();
+        detail::assume_nonnull( ptr_ );
+        return ptr_;
+    }
+
+    const T* NOVA_NONNULL get() const noexcept NOVA_RETURNS_NONNULL
+    {
+        detail::assume_nonnull( ptr_ );
+        return ptr_;
+    }
+
+    T* NOVA_NONNULL operator->() noexcept( nothrow_access ) NOVA_RETURNS_NONNULL
+    {
+        return get();
+    }
+
+    const T* NOVA_NONNULL operator->() const noexcept NOVA_RETURNS_NONNULL
+    {
+        return get();
+    }
+
+    T& operator*() & noexcept( nothrow_access )
+    {
+        return *get();
+    }
+
+    const T& operator*() const& noexcept
+    {
+        return *get();
+    }
+
+    T&& operator*() && noexcept( nothrow_access )
+    {
+        return std::move( *get() );
+    }
+
+    /**
+     * @brief Returns a non_null view of the owned object that must not outlive
+     *        the box (lifetimebound).
+     */
+    non_null< T* > borrow() & noexcept( nothrow_access ) NOVA_LIFETIMEBOUND
+    {
+        return non_null< T* >( get() );
+    }
+
+    non_null< const T* > borrow() const& noexcept NOVA_LIFETIMEBOUND
+    {
+        return non_null< const T* >( get() );
+    }
+
+    non_null< T* > borrow() && noexcept = delete;
+
+    /**
+     * @brief Returns true if the owned object lives in the inline buffer.
+     */
+    bool stored_inline() const noexcept
+    {
+        return ops_ && ops_->stored_inline;
+    }
+
+    /**
+     * @brief Always returns true; a box always owns an object.
+     */
+    constexpr explicit operator bool() const noexcept
+    {
+        return true;
+    }
+
+    /**
+     * @brief Exchanges the owned objects. Heap objects are swapped by pointer,
+     *        inline objects are moved.
+     */
+    void swap( non_null_box& other ) noexcept
+    {
+        if ( this == &other )
+            return;
+        if ( !stored_inline() && !other.stored_inline() ) {
+            std::swap( ptr_, other.ptr_ );
+            std::swap( ops_, other.ops_ );
+            return;
+        }
+        non_null_box tmp( adopt_tag {}, *this );
+        adopt( other );
+        other.adopt( tmp );
+    }
+
+    /**
+     * @brief Compares the owned objects.
+     */
+    friend bool operator==( const non_null_box& lhs, const non_null_box& rhs )
+        requires std::equality_comparable< T >
+    {
+        return *lhs == *rhs;
+    }
+
+private:
+    non_null_box( adopt_tag, non_null_box& other ) noexcept
+    {
+        take_from( other );
+    }
+
+    // Shared by all moved-from boxes. ptr_ refers to it only while ops_ is
+    // null; the non-const accessors materialise() first, so only the const
+    // accessors hand it out.
+    static T* sentinel() noexcept
+        requires has_sentinel
+    {
+        static const T object {};
+        return const_cast< T* >( &object );
+    }
+
+    // Gives a moved-from box a value-initialised T of its own.
+    void materialise() noexcept( nothrow_access )
+        requires has_sentinel
+    {
+        ptr_ = ops_for< T >::create( buffer_.get() );
+        ops_ = &ops_for< T >::table;
+    }
+
+    static const detail::box_ops< T >* sentinel_ops() noexcept
+    {
+        if constexpr ( has_sentinel )
+            return &ops_for< T >::table;
+        else
+            return nullptr;
+    }
+
+    // Takes over the object of other: inline objects are moved (other keeps the
+    // moved-from object), heap objects are stolen and other is left without
+    // ownership (ops_ == nullptr) for the caller to re-point or discard.
+    void take_from( non_null_box& other ) noexcept
+    {
+        if ( other.stored_inline() ) {
+            ptr_ = other.ops_->move( *other.ptr_, buffer_.get() );
+            ops_ = other.ops_;
+        } else {
+            ptr_ = other.ptr_;
+            ops_ = std::exchange( other.ops_, nullptr );
+        }
+    }
+
+    void adopt( non_null_box& other ) noexcept
+    {
+        destroy();
+        take_from( other );
+    }
+
+    void destroy() noexcept
+    {
+        if ( ops_ )
+            ops_->destroy( ptr_ );
+    }
+
+    T*                                                   ptr_;
+    const detail::box_ops< T >*                          ops_;
+    [[no_unique_address]] detail::box_buffer< Capacity > buffer_;
+};
+
+/**
+ * @brief ADL swap for non_null_box.
+ */
+template < typename T, std::size_t Capacity >
+void swap( non_null_box< T, Capacity >& lhs, non_null_box< T, Capacity >& rhs ) noexcept
+{
+    lhs.swap( rhs );
+}
+
+/**
+ * @brief A box without inline buffer is a pointer pair and can be relocated
+ *        with memcpy; an inline buffer is self-referenced and cannot.
+ */
+template < typename T >
+struct is_trivially_relocatable< non_null_box< T, 0 > > : std::true_type
+{};
+
+} // namespace nova
+
+#include <nova/non_null/detail/epilogue.hpp>
@@ -0,0 +1,594 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2026 Tim Blechmann
+
+#pragma once
+
+#include <nova/non_null/core.hpp>
+
+#include <iterator>
+#include <optional>
+#include <ranges>
+#include <span>
+
+#include <nova/non_null/detail/prologue.hpp>
+
+#if defined( NOVA_HAVE_AVX2 ) || defined( NOVA_HAVE_SSE2 )
+#    include <immintrin.h>
+#endif
+
+namespace nova {
+
+// =============================================================================
+// bulk validation
+// =============================================================================
+
+namespace detail {
+
+template < typename T >
+constexpr std::size_t find_first_null_scalar( T* const* ptrs, std::size_t first, std::size_t count ) noexcept
+{
+    for ( std::size_t i = first; i != count; ++i )
+        if ( ptrs[ i ] == nullptr )
+            return i;
+    return count;
+}
+
+#if defined( NOVA_HAVE_AVX2 ) || defined( NOVA_HAVE_SSE2 )
+/**
+ * @brief Index of the first block of 8 pointers in [ptrs, ptrs + count) that
+ *        contains a null, or the start of the incomplete tail block. The
+ *        element-wise search resumes from the returned index.
+ */
+template < typename T >
+inline std::size_t skip_non_null_blocks( T* const* ptrs, std::size_t count ) noexcept
+{
+    constexpr std::size_t block = 8;
+    const char*           bytes = reinterpret_cast< const char* >( ptrs );
+
+    std::size_t i = 0;
+#    if defined( NOVA_HAVE_AVX2 )
+    constexpr std::size_t lanes = 32 / sizeof( T* ); // pointers per register
+    const __m256i         zero  = _mm256_setzero_si256();
+    auto                  nulls = [ & ]( std::size_t at ) {
+        const __m256i v = _mm256_loadu_si256( reinterpret_cast< const __m256i* >( bytes + at * sizeof( T* ) ) );
+        if constexpr ( sizeof( T* ) == 8 )
+            return _mm256_cmpeq_epi64( v, zero );
+        else
+            return _mm256_cmpeq_epi32( v, zero );
+    };
+    for ( ; i + block <= count; i += block ) {
+        __m256i any = nulls( i );
+        for ( std::size_t lane = lanes; lane != block; lane += lanes )
+            any = _mm256_or_si256( any, nulls( i + lane ) );
+        if ( _mm256_movemask_epi8( any ) != 0 )
+            break;
+    }
+#    else
+    constexpr std::size_t lanes = 16 / sizeof( T* );
+    const __m128i         zero  = _mm_setzero_si128();
+    auto                  nulls = [ & ]( std::size_t at ) {
+        const __m128i v = _mm_loadu_si128( reinterpret_cast< const __m128i* >( bytes + at * sizeof( T* ) ) );
+        const __m128i e = _mm_cmpeq_epi32( v, zero );
+        if constexpr ( sizeof( T* ) == 8 )
+            // SSE2 has no 64-bit compare: a pointer is null if both halves are.
+            return _mm_and_si128( e, _mm_shuffle_epi32( e, _MM_SHUFFLE( 2, 3, 0, 1 ) ) );
+        else
+            return e;
+    };
+    for ( ; i + block <= count; i += block ) {
+        __m128i any = nulls( i );
+        for ( std::size_t lane = lanes; lane != block; lane += lanes )
+            any = _mm_or_si128( any, nulls( i + lane ) );
+        if ( _mm_movemask_epi8( any ) != 0 )
+            break;
+    }
+#    endif
+    return i;
+}
+#endif
+
+} // namespace detail
+
+/**
+ * @brief Returns the index of the first null pointer in [ptrs, ptrs + count),
+ *        or count if there is none.
+ *
+ * Scans blocks of pointers with SSE2 / AVX2 where available, so validating a
+ * buffer costs one branch per block rather than one per element.
+ */
+template < typename T >
+constexpr std::size_t find_first_null( T* const* ptrs, std::size_t count ) noexcept
+{
+    std::size_t first = 0;
+#if defined( NOVA_HAVE_AVX2 ) || defined( NOVA_HAVE_SSE2 )
+    if ( !std::is_constant_evaluated() && ( sizeof( T* ) == 8 || sizeof( T* ) == 4 ) )
+        first = detail::skip_non_null_blocks( ptrs, count );
+#endif
+    return detail::find_first_null_scalar( ptrs, first, count );
+}
+
+/**
+ * @brief Range overload of find_first_null for contiguous ranges of raw
+ *        pointers (std::vector<T*>, std::span<T*>, arrays, ...).
+ */
+template < std::ranges::contiguous_range R >
+    requires std::ranges::sized_range< R > && std::is_pointer_v< std::ranges::range_value_t< R > >
+constexpr std::size_t find_first_null( R&& range ) noexcept
+{
+    return find_first_null( std::ranges::data( range ), std::ranges::size( range ) );
+}
+
+/**
+ * @brief A view of a validated buffer of raw pointers whose elements are
+ *        non_null<T*, Policy>.
+ *
+ * The buffer holds T* objects, so the view does not reinterpret it as an
+ * array of non_null: each element is converted on access, with the non-null
+ * hint and without a contract check. The conversion compiles to a plain load.
+ * Obtained from try_make_non_null_range, which validates the buffer.
+ */
+template < typename T, contract_policy Policy = contract_default >
+class non_null_range
+{
+public:
+    using value_type = non_null< T*, Policy >;
+    using size_type  = std::size_t;
+
+    class iterator
+    {
+    public:
+        using iterator_concept  = std::random_access_iterator_tag;
+        using iterator_category = std::input_iterator_tag;
+        using value_type        = non_null< T*, Policy >;
+        using difference_type   = std::ptrdiff_t;
+
+        constexpr iterator() noexcept = default;
+
+        constexpr value_type operator*() const noexcept
+        {
+            return non_null_range::element( *it_ );
+        }
+
+        constexpr value_type operator[]( difference_type n ) const noexcept
+        {
+            return non_null_range::element( it_[ n ] );
+        }
+
+        constexpr iterator& operator++() noexcept
+        {
+            ++it_;
+            return *this;
+        }
+
+        constexpr iterator operator++( int ) noexcept
+        {
+            return iterator( it_++ );
+        }
+
+        constexpr iterator& operator--() noexcept
+        {
+            --it_;
+            return *this;
+        }
+
+        constexpr iterator operator--( int ) noexcept
+        {
+            return iterator( it_-- );
+        }
+
+        constexpr iterator& operator+=( difference_type n ) noexcept
+        {
+            it_ += n;
+            return *this;
+        }
+
+        constexpr iterator& operator-=( difference_type n ) noexcept
+        {
+            it_ -= n;
+            return *this;
+        }
+
+        friend constexpr iterator operator+( iterator it, difference_type n ) noexcept
+        {
+            return it += n;
+        }
+
+        friend constexpr iterator operator+( difference_type n, iterator it ) noexcept
+        {
+            return it += n;
+        }
+
+        friend constexpr iterator operator-( iterator it, difference_type n ) noexcept
+        {
+            return it -= n;
+        }
+
+        friend constexpr difference_type operator-( iterator lhs, iterator rhs ) noexcept
+        {
+            return lhs.it_ - rhs.it_;
+        }
+
+        friend constexpr bool                 operator==( iterator, iterator ) noexcept  = default;
+        friend constexpr std::strong_ordering operator<=>( iterator, iterator ) noexcept = default;
+
+    private:
+        friend class non_null_range;
+
+        constexpr explicit iterator( T* const* it ) noexcept :
+            it_( it )
+        {}
+
+        T* const* it_ = nullptr;
+    };
+
+    constexpr iterator begin() const noexcept
+    {
+        return iterator( ptrs_ );
+    }
+
+    constexpr iterator end() const noexcept
+    {
+        return iterator( ptrs_ + size_ );
+    }
+
+    constexpr size_type size() const noexcept
+    {
+        return size_;
+    }
+
+    [[nodiscard]] constexpr bool empty() const noexcept
+    {
+        return size_ == 0;
+    }
+
+    constexpr value_type operator[]( size_type i ) const noexcept
+    {
+        assert( i < size_ && "nova::non_null_range: index out of range" );
+        return element( ptrs_[ i ] );
+    }
+
+    /**
+     * @brief Returns the validated buffer.
+     */
+    constexpr T* const* data() const noexcept
+    {
+        return ptrs_;
+    }
+
+private:
+    template < contract_policy P, typename U >
+    friend constexpr std::optional< non_null_range< U, P > > try_make_non_null_range( U* const* ptrs,
+                                                                                    std::size_t count ) noexcept;
+
+    constexpr non_null_range( T* const* ptrs, size_type count ) noexcept :
+        ptrs_( ptrs ),
+        size_( count )
+    {}
+
+    static constexpr value_type element( T* p ) noexcept
+    {
+        return value_type( non_null< T*, contract_trust >( p ) );
+    }
+
+    T* const* ptrs_;
+    size_type size_;
+};
+
+/**
+ * @brief Validates a buffer of raw pointers once and views it as non_null<T*>.
+ *
+ * The result refers to the original buffer; iterating it needs no per-element
+ * checks.
+ *
+ * @return A non_null_range over the same storage, or std::nullopt if any
+ *         element is null (use find_first_null to locate it).
+ */
+template < contract_policy Policy = contract_default, typename T >
+constexpr std::optional< non_null_range< T, Policy > > try_make_non_null_range( T* const* ptrs,
+                                                                                std::size_t count ) noexcept
+{
+    if ( find_first_null( ptrs, count ) != count )
+        return std::nullopt;
+    return non_null_range< T, Policy >( ptrs, count );
+}
+
+template < contract_policy Policy = contract_default, std::ranges::contiguous_range R >
+    requires std::ranges::sized_range< R > && std::ranges::borrowed_range< R >
+             && std::is_pointer_v< std::ranges::range_value_t< R > >
+auto try_make_non_null_range( R&& range ) noexcept
+{
+    return try_make_non_null_range< Policy >( std::ranges::data( range ), std::ranges::size( range ) );
+}
+
+// =============================================================================
+// non_null_span / non_empty_span
+// =============================================================================
+
+template < typename T >
+class non_null_span;
+
+template < typename T, contract_policy Policy = contract_default >
+class non_empty_span;
+
+namespace detail {
+
+template < typename T >
+inline constexpr bool is_non_null_span = false;
+
+template < typename T >
+inline constexpr bool is_non_null_span< non_null_span< T > > = true;
+
+template < typename T, typename P >
+inline constexpr bool is_non_null_span< non_empty_span< T, P > > = true;
+
+/**
+ * @brief A non-null, suitably aligned address that must not be dereferenced;
+ *        used as the data pointer of empty views over storage without one
+ *        (e.g. an empty std::vector).
+ */
+template < typename T >
+NOVA_RETURNS_NONNULL inline T* NOVA_NONNULL dangling() noexcept
+{
+    return reinterpret_cast< T* >( alignof( T ) );
+}
+
+template < typename R, typename T >
+concept span_compatible_range
+    = std::ranges::contiguous_range< R > && std::ranges::sized_range< R >
+   && ( std::ranges::borrowed_range< R > || std::is_const_v< T > )
+   && std::is_convertible_v< std::remove_reference_t< std::ranges::range_reference_t< R > > ( * )[], T ( * )[] >;
+
+} // namespace detail
+
+/**
+ * @brief A std::span-like view whose data pointer is never null.
+ *
+ * Holds a raw T* and a size, and is trivially copyable, so it is passed in
+ * two registers. data() returns non_null<T*>, and element access needs no
+ * null check. Converts implicitly from std::vector, std::array, std::span and
+ * other contiguous ranges; an empty range without storage gets a dangling,
+ * non-null data pointer.
+ *
+ * @tparam T The element type (const-qualified for read-only views).
+ */
+template < typename T >
+class non_null_span
+{
+public:
+    using element_type    = T;
+    using value_type      = std::remove_cv_t< T >;
+    using size_type       = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using pointer         = T*;
+    using reference       = T&;
+    using iterator        = T*;
+
+    template < typename P >
+    constexpr non_null_span( non_null< T*, P > data, size_type count ) noexcept :
+        ptr_( data.get() ),
+        size_( count )
+    {}
+
+    template < typename R >
+        requires detail::span_compatible_range< R, T > && ( !detail::is_non_null_span< std::remove_cvref_t< R > > )
+    constexpr non_null_span( R&& range ) noexcept :
+        ptr_( std::ranges::data( range ) ),
+        size_( std::ranges::size( range ) )
+    {
+        if ( ptr_ == nullptr )
+            ptr_ = detail::dangling< T >();
+    }
+
+    template < typename U >
+        requires std::is_convertible_v< U ( * )[], T ( * )[] >
+    constexpr non_null_span( const non_null_span< U >& other ) noexcept :
+        ptr_( other.data().get() ),
+        size_( other.size() )
+    {}
+
+    non_null_span( std::nullptr_t, size_type ) = delete;
+
+    constexpr non_null< T* > data() const noexcept
+    {
+        detail::assume_nonnull( ptr_ );
+        return non_null< T* >( ptr_ );
+    }
+
+    constexpr size_type size() const noexcept
+    {
+        return size_;
+    }
+
+    constexpr size_type size_bytes() const noexcept
+    {
+        return size_ * sizeof( T );
+    }
+
+    [[nodiscard]] constexpr bool empty() const noexcept
+    {
+        return size_ == 0;
+    }
+
+    constexpr T* NOVA_NONNULL begin() const noexcept NOVA_RETURNS_NONNULL
+    {
+        detail::assume_nonnull( ptr_ );
+        return ptr_;
+    }
+
+    constexpr T* NOVA_NONNULL end() const noexcept NOVA_RETURNS_NONNULL
+    {
+        detail::assume_nonnull( ptr_ );
+        return ptr_ + size_;
+    }
+
+    constexpr reference operator[]( size_type i ) const noexcept
+    {
+        assert( i < size_ && "nova::non_null_span: index out of range" );
+        detail::assume_nonnull( ptr_ );
+        return ptr_[ i ];
+    }
+
+    /**
+     * @brief First / last element. The span must not be empty; see
+     *        non_empty_span for a view that guarantees this.
+     */
+    constexpr reference front() const noexcept
+    {
+        assert( size_ != 0 && "nova::non_null_span: front() of an empty span" );
+        return *begin();
+    }
+
+    constexpr reference back() const noexcept
+    {
+        assert( size_ != 0 && "nova::non_null_span: back() of an empty span" );
+        return *( end() - 1 );
+    }
+
+    /**
+     * @brief Sub-views; the data pointer stays non-null.
+     */
+    constexpr non_null_span first( size_type count ) const noexcept
+    {
+        assert( count <= size_ );
+        return non_null_span( data(), count );
+    }
+
+    constexpr non_null_span last( size_type count ) const noexcept
+    {
+        assert( count <= size_ );
+        return non_null_span( non_null< T* >( begin() + ( size_ - count ) ), count );
+    }
+
+    constexpr non_null_span subspan( size_type offset, size_type count = std::dynamic_extent ) const noexcept
+    {
+        assert( offset <= size_ );
+        if ( count == std::dynamic_extent )
+            count = size_ - offset;
+        assert( count <= size_ - offset );
+        return non_null_span( non_null< T* >( begin() + offset ), count );
+    }
+
+protected:
+    T*        ptr_;
+    size_type size_;
+};
+
+template < typename T, typename P >
+non_null_span( non_null< T*, P >, std::size_t ) -> non_null_span< T >;
+
+template < std::ranges::contiguous_range R >
+non_null_span( R&& ) -> non_null_span< std::remove_reference_t< std::ranges::range_reference_t< R > > >;
+
+/**
+ * @brief A non_null_span that is also never empty.
+ *
+ * front() and back() need no checks, and loops over the view need no
+ * empty prologue: size() is known to be at least one. Construction from a
+ * range is checked by Policy; try_make_non_empty_span returns an optional
+ * instead.
+ *
+ * @tparam T      The element type.
+ * @tparam Policy The contract policy applied on construction.
+ */
+template < typename T, contract_policy Policy >
+class non_empty_span : public non_null_span< T >
+{
+    using base = non_null_span< T >;
+
+public:
+    using typename base::reference;
+    using typename base::size_type;
+
+    template < typename P >
+    constexpr non_empty_span( non_null< T*, P >           data,
+                              size_type                   count,
+                              const std::source_location& where = std::source_location::current() ) :
+        base( data, count )
+    {
+        Policy::check( count != 0, "nova::non_empty_span: span cannot be empty", where );
+    }
+
+    template < typename R >
+        requires detail::span_compatible_range< R, T > && ( !detail::is_non_null_span< std::remove_cvref_t< R > > )
+    constexpr explicit non_empty_span( R&&                         range,
+                                       const std::source_location& where = std::source_location::current() ) :
+        base( std::forward< R >( range ) )
+    {
+        Policy::check( this->size_ != 0, "nova::non_empty_span: span cannot be empty", where );
+    }
+
+    template < typename U, typename Q >
+        requires std::is_convertible_v< U ( * )[], T ( * )[] >
+    constexpr non_empty_span( const non_empty_span< U, Q >& other ) noexcept :
+        base( other )
+    {}
+
+    constexpr size_type size() const noexcept
+    {
+        NOVA_ASSUME( this->size_ != 0 );
+        return this->size_;
+    }
+
+    [[nodiscard]] constexpr bool empty() const noexcept
+    {
+        return false;
+    }
+
+    constexpr T* NOVA_NONNULL end() const noexcept NOVA_RETURNS_NONNULL
+    {
+        T* last = this->begin() + size();
+        NOVA_ASSUME( last != this->begin() );
+        return last;
+    }
+
+    constexpr reference front() const noexcept
+    {
+        return *this->begin();
+    }
+
+    constexpr reference back() const noexcept
+    {
+        return *( end() - 1 );
+    }
+};
+
+template < typename T, typename P >
+non_empty_span( non_null< T*, P >, std::size_t ) -> non_empty_span< T >;
+
+template < std::ranges::contiguous_range R >
+non_empty_span( R&& ) -> non_empty_span< std::remove_reference_t< std::ranges::range_reference_t< R > > >;
+
+/**
+ * @brief Returns a non_empty_span over range, or std::nullopt if it is empty.
+ */
+template < contract_policy Policy = contract_default, std::ranges::contiguous_range R >
+    requires std::ranges::sized_range< R >
+constexpr auto try_make_non_empty_span( R&& range ) noexcept
+{
+    using span_type = non_empty_span< std::remove_reference_t< std::ranges::range_reference_t< R > >, Policy >;
+    if ( std::ranges::empty( range ) )
+        return std::optional< span_type >();
+    return std::optional< span_type >( span_type( std::forward< R >( range ) ) );
+}
+
+} // namespace nova
+
+template < typename T >
+inline constexpr bool std::ranges::enable_borrowed_range< nova::non_null_span< T > > = true;
+
+template < typename T, typename P >
+inline constexpr bool std::ranges::enable_borrowed_range< nova::non_empty_span< T, P > > = true;
+
+template < typename T, typename P >
+inline constexpr bool std::ranges::enable_borrowed_range< nova::non_null_range< T, P > > = true;
+
+template < typename T >
+inline constexpr bool std::ranges::enable_view< nova::non_null_span< T > > = true;
+
+template < typename T, typename P >
+inline constexpr bool std::ranges::enable_view< nova::non_empty_span< T, P > > = true;
+
+template < typename T, typename P >
+inline constexpr bool std::ranges::enable_view< nova::non_null_range< T, P > > = true;
+
+#include <nova/non_null/detail/epilogue.hpp>
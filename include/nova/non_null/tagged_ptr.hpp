@@ -0,0 +1,322 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2026 Tim Blechmann
+
+#pragma once
+
+#include <nova/non_null/atomic.hpp>
+
+#include <nova/non_null/detail/prologue.hpp>
+
+namespace nova {
+
+// =============================================================================
+// non_null_tagged_ptr
+// =============================================================================
+
+/**
+ * @brief A non-null T* with Bits small tag bits packed into its alignment bits.
+ *
+ * One word: a node link and its "kind" or "dirty" tag share the same
+ * storage. get() masks the tag off and still carries the non-null hint, and
+ * the tag can be read and written independently of the pointer. Trivially
+ * copyable; see non_null_atomic<non_null_tagged_ptr<T, Bits>> for the atomic
+ * variant.
+ *
+ * @tparam T    The pointee type; may be incomplete where the tagged pointer is
+ *              named (e.g. a link inside its own node type).
+ * @tparam Bits Number of tag bits; at most log2(alignof(T)), which is checked
+ *              on construction.
+ */
+template < typename T, unsigned Bits >
+class non_null_tagged_ptr
+{
+public:
+    using element_type = T;
+    using pointer      = T*;
+    using tag_type     = std::uintptr_t;
+
+    static constexpr unsigned tag_bits = Bits;
+    static constexpr tag_type tag_mask = ( tag_type( 1 ) << Bits ) - 1;
+
+    static_assert( Bits < sizeof( tag_type ) * 8, "nova::non_null_tagged_ptr: too many tag bits" );
+
+    /**
+     * @brief Constructs from a non-null pointer and a tag.
+     * @param tag Must fit in Bits bits.
+     */
+    explicit non_null_tagged_ptr( non_null< T* > p, tag_type tag = 0 ) noexcept :
+        bits_( encode( p.get(), tag ) )
+    {}
+
+    non_null_tagged_ptr( std::nullptr_t, tag_type = 0 ) = delete;
+
+    /**
+     * @brief Returns the pointer with the tag masked off.
+     */
+    T* NOVA_NONNULL get() const noexcept NOVA_RETURNS_NONNULL
+    {
+        T* p = reinterpret_cast< T* >( bits_ & ~tag_mask );
+        detail::assume_nonnull( p );
+        return p;
+    }
+
+    non_null< T* > untagged() const noexcept
+    {
+        return non_null< T* >( get() );
+    }
+
+    /**
+     * @brief Same as untagged(); the tagged pointer does not own its pointee.
+     */
+    non_null< T* > borrow() const noexcept
+    {
+        return untagged();
+    }
+
+    T* NOVA_NONNULL operator->() const noexcept NOVA_RETURNS_NONNULL
+    {
+        return get();
+    }
+
+    T& operator*() const noexcept
+    {
+        return *get();
+    }
+
+    constexpr explicit operator bool() const noexcept
+    {
+        return true;
+    }
+
+    constexpr tag_type tag() const noexcept
+    {
+        return bits_ & tag_mask;
+    }
+
+    /**
+     * @brief Replaces the tag, keeping the pointer.
+     */
+    constexpr void set_tag( tag_type tag ) noexcept
+    {
+        assert( ( tag & ~tag_mask ) == 0 && "nova::non_null_tagged_ptr: tag does not fit in Bits" );
+        bits_ = ( bits_ & ~tag_mask ) | tag;
+    }
+
+    /**
+     * @brief Replaces the pointer, keeping the tag.
+     */
+    void set_pointer( non_null< T* > p ) noexcept
+    {
+        bits_ = encode( p.get(), tag() );
+    }
+
+    /**
+     * @brief The packed representation, and its inverse. from_bits requires a
+     *        value previously returned by to_bits.
+     */
+    constexpr tag_type to_bits() const noexcept
+    {
+        return bits_;
+    }
+
+    static non_null_tagged_ptr from_bits( tag_type bits ) noexcept
+    {
+        assert( ( bits & ~tag_mask ) != 0 && "nova::non_null_tagged_ptr: pointer cannot be null" );
+        return non_null_tagged_ptr( bits );
+    }
+
+    /**
+     * @brief Compares pointer and tag.
+     */
+    friend constexpr bool operator==( const non_null_tagged_ptr& lhs, const non_null_tagged_ptr& rhs ) noexcept
+    {
+        return lhs.bits_ == rhs.bits_;
+    }
+
+private:
+    constexpr explicit non_null_tagged_ptr( tag_type bits ) noexcept :
+        bits_( bits )
+    {}
+
+    static tag_type encode( T* p, tag_type tag ) noexcept
+    {
+        static_assert( ( alignof( T ) & tag_mask ) == 0,
+                       "nova::non_null_tagged_ptr: alignof(T) leaves fewer than Bits low bits" );
+        const auto address = reinterpret_cast< tag_type >( p );
+        assert( ( address & tag_mask ) == 0 && "nova::non_null_tagged_ptr: pointer is not sufficiently aligned" );
+        assert( ( tag & ~tag_mask ) == 0 && "nova::non_null_tagged_ptr: tag does not fit in Bits" );
+        return address | tag;
+    }
+
+    tag_type bits_;
+};
+
+/**
+ * @brief A lock-free atomic non_null_tagged_ptr.
+ *
+ * Pointer and tag are updated together with a single atomic word; the tag
+ * alone can be modified with fetch_or_tag / fetch_and_tag (one atomic RMW
+ * each) or exchange_tag.
+ */
+template < typename T, unsigned Bits >
+class non_null_atomic< non_null_tagged_ptr< T, Bits > >
+{
+public:
+    using value_type = non_null_tagged_ptr< T, Bits >;
+    using tag_type   = typename value_type::tag_type;
+
+    static constexpr bool is_always_lock_free = std::atomic< tag_type >::is_always_lock_free;
+    static_assert( is_always_lock_free, "nova::non_null_atomic: std::atomic<std::uintptr_t> must be lock-free" );
+
+    explicit non_null_atomic( value_type p ) noexcept :
+        bits_( p.to_bits() )
+    {}
+
+    non_null_atomic( const non_null_atomic& )            = delete;
+    non_null_atomic& operator=( const non_null_atomic& ) = delete;
+
+    non_null_atomic( std::nullptr_t )            = delete;
+    non_null_atomic& operator=( std::nullptr_t ) = delete;
+
+    value_type load( std::memory_order order = std::memory_order_seq_cst ) const noexcept
+    {
+        return value_type::from_bits( bits_.load( order ) );
+    }
+
+    operator value_type() const noexcept
+    {
+        return load();
+    }
+
+    void store( value_type desired, std::memory_order order = std::memory_order_seq_cst ) noexcept
+    {
+        bits_.store( desired.to_bits(), order );
+    }
+
+    value_type operator=( value_type desired ) noexcept
+    {
+        store( desired );
+        return desired;
+    }
+
+    value_type exchange( value_type desired, std::memory_order order = std::memory_order_seq_cst ) noexcept
+    {
+        return value_type::from_bits( bits_.exchange( desired.to_bits(), order ) );
+    }
+
+    /**
+     * @brief Atomic compare-and-exchange of pointer and tag. On failure,
+     *        expected receives the current value.
+     */
+    bool compare_exchange_weak( value_type&       expected,
+                                value_type        desired,
+                                std::memory_order success,
+                                std::memory_order failure ) noexcept
+    {
+        tag_type current = expected.to_bits();
+        if ( bits_.compare_exchange_weak( current, desired.to_bits(), success, failure ) )
+            return true;
+        expected = value_type::from_bits( current );
+        return false;
+    }
+
+    bool compare_exchange_weak( value_type&       expected,
+                                value_type        desired,
+                                std::memory_order order = std::memory_order_seq_cst ) noexcept
+    {
+        tag_type current = expected.to_bits();
+        if ( bits_.compare_exchange_weak( current, desired.to_bits(), order ) )
+            return true;
+        expected = value_type::from_bits( current );
+        return false;
+    }
+
+    bool compare_exchange_strong( value_type&       expected,
+                                  value_type        desired,
+                                  std::memory_order success,
+                                  std::memory_order failure ) noexcept
+    {
+        tag_type current = expected.to_bits();
+        if ( bits_.compare_exchange_strong( current, desired.to_bits(), success, failure ) )
+            return true;
+        expected = value_type::from_bits( current );
+        return false;
+    }
+
+    bool compare_exchange_strong( value_type&       expected,
+                                  value_type        desired,
+                                  std::memory_order order = std::memory_order_seq_cst ) noexcept
+    {
+        tag_type current = expected.to_bits();
+        if ( bits_.compare_exchange_strong( current, desired.to_bits(), order ) )
+            return true;
+        expected = value_type::from_bits( current );
+        return false;
+    }
+
+    /**
+     * @brief Atomically sets / clears tag bits, leaving the pointer unchanged.
+     * @return The previous value.
+     */
+    value_type fetch_or_tag( tag_type tag, std::memory_order order = std::memory_order_seq_cst ) noexcept
+    {
+        assert( ( tag & ~value_type::tag_mask ) == 0 && "nova::non_null_atomic: tag does not fit in Bits" );
+        return value_type::from_bits( bits_.fetch_or( tag, order ) );
+    }
+
+    value_type fetch_and_tag( tag_type tag, std::memory_order order = std::memory_order_seq_cst ) noexcept
+    {
+        assert( ( tag & ~value_type::tag_mask ) == 0 && "nova::non_null_atomic: tag does not fit in Bits" );
+        return value_type::from_bits( bits_.fetch_and( tag | ~value_type::tag_mask, order ) );
+    }
+
+    /**
+     * @brief Atomically replaces the tag, leaving the pointer unchanged.
+     * @return The previous value.
+     */
+    value_type exchange_tag( tag_type tag, std::memory_order order = std::memory_order_seq_cst ) noexcept
+    {
+        value_type expected = load( std::memory_order_relaxed );
+        value_type desired  = expected;
+        do {
+            desired = expected;
+            desired.set_tag( tag );
+        } while ( !compare_exchange_weak( expected, desired, order, std::memory_order_relaxed ) );
+        return expected;
+    }
+
+#if defined( __cpp_lib_atomic_wait ) && __cpp_lib_atomic_wait >= 201907L
+    /**
+     * @brief Blocks until pointer or tag differ from old (C++20 atomic wait).
+     */
+    void wait( value_type old, std::memory_order order = std::memory_order_seq_cst ) const noexcept
+    {
+        bits_.wait( old.to_bits(), order );
+    }
+
+    void notify_one() noexcept
+    {
+        bits_.notify_one();
+    }
+
+    void notify_all() noexcept
+    {
+        bits_.notify_all();
+    }
+#endif
+
+    bool is_lock_free() const noexcept
+    {
+        return bits_.is_lock_free();
+    }
+
+private:
+    std::atomic< tag_type > bits_;
+};
+
+template < typename T, unsigned Bits >
+using non_null_atomic_tagged_ptr = non_null_atomic< non_null_tagged_ptr< T, Bits > >;
+
+} // namespace nova
+
+#include <nova/non_null/detail/epilogue.hpp>
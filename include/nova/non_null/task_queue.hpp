@@ -0,0 +1,260 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2026 Tim Blechmann
+
+#pragma once
+
+#include <nova/non_null/functional.hpp>
+
+#include <atomic>
+#include <thread>
+
+#include <nova/non_null/detail/prologue.hpp>
+
+namespace nova {
+
+#if defined( __cpp_lib_move_only_function ) && __cpp_lib_move_only_function >= 202110L
+
+// =============================================================================
+// non_null_task_queue  (C++23)
+// =============================================================================
+
+/**
+ * @brief Default inline task capacity of non_null_task_queue, in bytes: large
+ *        enough to hold a std::move_only_function<void()>.
+ */
+inline constexpr std::size_t task_queue_default_task_capacity = sizeof( std::move_only_function< void() > );
+
+/**
+ * @brief A bounded, lock-free multi-producer single-consumer queue of
+ *        never-empty void() tasks.
+ *
+ * Tasks live inline in a ring of Capacity cache-line-aligned slots, each holding
+ * an inplace_function<void(), TaskCapacity>. Producers claim a slot with a single
+ * CAS on the tail and publish it with a release store of the slot's sequence
+ * number; the consumer owns the head and needs no read-modify-write at all.
+ *
+ * Tasks enter the queue only as non_null_move_only_function (consumed through
+ * take()), non_null_inplace_function, or a class-type callable that is stored
+ * inline directly. None of these can be empty, so try_run_one() invokes the
+ * slot without an empty-callable check. Callables pushed through emplace or
+ * non_null_inplace_function never touch the heap; a non_null_move_only_function
+ * keeps whatever storage its std::move_only_function already owns.
+ *
+ * A producer that stalls between claiming and publishing its slot holds back
+ * the consumer at that slot; other producers are not blocked. Pending tasks are
+ * destroyed without being run when the queue is destroyed.
+ *
+ * @tparam Capacity     Number of slots; must be a power of two.
+ * @tparam TaskCapacity Inline storage per task, in bytes.
+ */
+template < std::size_t Capacity, std::size_t TaskCapacity = task_queue_default_task_capacity >
+class non_null_task_queue
+{
+    static_assert( Capacity >= 2 && ( Capacity & ( Capacity - 1 ) ) == 0,
+                   "nova::non_null_task_queue: capacity must be a power of two" );
+
+public:
+    using task_type = inplace_function< void(), TaskCapacity >;
+
+    static constexpr std::size_t capacity      = Capacity;
+    static constexpr std::size_t task_capacity = TaskCapacity;
+
+private:
+    struct alignas( 64 ) slot
+    {
+        std::atomic< std::size_t > sequence;
+        task_type                  task;
+    };
+
+    // Empties the slot and hands it back to the producers, also if the task throws.
+    struct release_guard
+    {
+        slot&       s;
+        std::size_t next_sequence;
+
+        ~release_guard()
+        {
+            s.task = nullptr;
+            s.sequence.store( next_sequence, std::memory_order_release );
+        }
+    };
+
+public:
+    non_null_task_queue() noexcept
+    {
+        for ( std::size_t i = 0; i != Capacity; ++i )
+            slots_[ i ].sequence.store( i, std::memory_order_relaxed );
+    }
+
+    non_null_task_queue( const non_null_task_queue& )            = delete;
+    non_null_task_queue& operator=( const non_null_task_queue& ) = delete;
+
+    /**
+     * @brief Enqueues a task if a slot is free. Safe to call from any thread.
+     *
+     * The task is consumed through take() only on success; if the queue is full
+     * it is left untouched and false is returned.
+     */
+    template < typename P >
+    bool try_push( non_null_move_only_function< void(), P >&& task ) noexcept
+    {
+        static_assert( sizeof( std::move_only_function< void() > ) <= TaskCapacity,
+                       "nova::non_null_task_queue: task capacity cannot hold a std::move_only_function" );
+        slot* s = claim();
+        if ( !s )
+            return false;
+        publish( *s, take( std::move( task ) ) );
+        return true;
+    }
+
+    /**
+     * @copydoc try_push
+     */
+    bool try_push( non_null_inplace_function< void(), TaskCapacity >&& task ) noexcept
+    {
+        slot* s = claim();
+        if ( !s )
+            return false;
+        publish( *s, take( std::move( task ) ) );
+        return true;
+    }
+
+    /**
+     * @brief Enqueues a callable, constructed in place in the slot, if a slot is
+     *        free. Safe to call from any thread.
+     *
+     * Only class types are accepted, so the stored task can never be empty. The
+     * callable must fit into TaskCapacity bytes and its construction from f must
+     * not throw (static_assert), as a claimed slot cannot be given back; if the
+     * queue is full f is not moved from and false is returned.
+     */
+    template < typename F >
+        requires std::is_class_v< std::remove_cvref_t< F > >
+                 && std::is_invocable_r_v< void, std::decay_t< F >& > && std::is_constructible_v< task_type, F >
+    bool try_emplace( F&& f ) noexcept
+    {
+        static_assert( std::is_nothrow_constructible_v< std::decay_t< F >, F >,
+                       "nova::non_null_task_queue: task construction must not throw, move the callable in" );
+        slot* s = claim();
+        if ( !s )
+            return false;
+        publish( *s, std::forward< F >( f ) );
+        return true;
+    }
+
+    /**
+     * @brief Enqueues a task, yielding while the queue is full.
+     */
+    template < typename P >
+    void push( non_null_move_only_function< void(), P >&& task ) noexcept
+    {
+        while ( !try_push( std::move( task ) ) )
+            std::this_thread::yield();
+    }
+
+    /**
+     * @copydoc push
+     */
+    void push( non_null_inplace_function< void(), TaskCapacity >&& task ) noexcept
+    {
+        while ( !try_push( std::move( task ) ) )
+            std::this_thread::yield();
+    }
+
+    /**
+     * @brief Enqueues a callable in place, yielding while the queue is full.
+     */
+    template < typename F >
+        requires std::is_class_v< std::remove_cvref_t< F > >
+                 && std::is_invocable_r_v< void, std::decay_t< F >& > && std::is_constructible_v< task_type, F >
+    void emplace( F&& f ) noexcept
+    {
+        while ( !try_emplace( std::forward< F >( f ) ) )
+            std::this_thread::yield();
+    }
+
+    /**
+     * @brief Runs the oldest published task, if any. Consumer thread only.
+     *
+     * The task is invoked in its slot and destroyed afterwards; the slot is
+     * released even if the task throws.
+     *
+     * @return false if no task was published.
+     */
+    bool try_run_one()
+    {
+        slot&             s   = slots_[ head_ & mask ];
+        const std::size_t pos = head_;
+        if ( s.sequence.load( std::memory_order_acquire ) != pos + 1 )
+            return false;
+
+        ++head_;
+        release_guard guard { s, pos + Capacity };
+        detail::assume_not_empty( s.task );
+        s.task();
+        return true;
+    }
+
+    /**
+     * @brief Runs published tasks until the queue is observed empty. Consumer
+     *        thread only.
+     * @return The number of tasks run.
+     */
+    std::size_t run_pending()
+    {
+        std::size_t count = 0;
+        while ( try_run_one() )
+            ++count;
+        return count;
+    }
+
+    /**
+     * @brief Returns true if no published task is waiting. Consumer thread only.
+     */
+    bool empty() const noexcept
+    {
+        return slots_[ head_ & mask ].sequence.load( std::memory_order_acquire ) != head_ + 1;
+    }
+
+private:
+    static constexpr std::size_t mask = Capacity - 1;
+
+    // Claims the slot at the tail, or returns nullptr if the queue is full.
+    slot* claim() noexcept
+    {
+        std::size_t pos = tail_.load( std::memory_order_relaxed );
+        for ( ;; ) {
+            slot&                s    = slots_[ pos & mask ];
+            const std::size_t    seq  = s.sequence.load( std::memory_order_acquire );
+            const std::ptrdiff_t diff = static_cast< std::ptrdiff_t >( seq - pos );
+            if ( diff == 0 ) {
+                if ( tail_.compare_exchange_weak( pos, pos + 1, std::memory_order_relaxed ) )
+                    return &s;
+            } else if ( diff < 0 ) {
+                return nullptr;
+            } else {
+                pos = tail_.load( std::memory_order_relaxed );
+            }
+        }
+    }
+
+    // Constructs the task into a claimed, empty slot and hands it to the consumer.
+    template < typename F >
+    static void publish( slot& s, F&& f ) noexcept
+    {
+        std::destroy_at( &s.task );
+        std::construct_at( &s.task, std::forward< F >( f ) );
+        detail::assume_not_empty( s.task );
+        s.sequence.store( s.sequence.load( std::memory_order_relaxed ) + 1, std::memory_order_release );
+    }
+
+    slot                                    slots_[ Capacity ];
+    alignas( 64 ) std::atomic< std::size_t > tail_ { 0 };
+    alignas( 64 ) std::size_t                head_ = 0;
+};
+
+#endif // __cpp_lib_move_only_function
+
+} // namespace nova
+
+#include <nova/non_null/detail/epilogue.hpp>
@@ -0,0 +1,440 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2026 Tim Blechmann
+
+#pragma once
+
+#include <nova/non_null/core.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <new>
+
+#include <nova/non_null/detail/prologue.hpp>
+
+namespace nova {
+
+// =============================================================================
+// relocation and non_null_vector
+// =============================================================================
+
+/**
+ * @brief Relocates *source into the uninitialised storage at dest: afterwards
+ *        dest holds the object and source is no longer alive (its destructor
+ *        must not be run).
+ *
+ * Trivially relocatable types are copied bytewise. Move-only non_null wrappers,
+ * whose move constructor is deleted, are relocated through take(), so no
+ * moved-from null is ever observable.
+ */
+template < typename T >
+T* relocate_at( T* NOVA_NONNULL source, T* NOVA_NONNULL dest ) noexcept
+{
+    if constexpr ( is_trivially_relocatable_v< T > ) {
+        std::memcpy( static_cast< void* >( dest ), static_cast< const void* >( source ), sizeof( T ) );
+        return std::launder( dest );
+    } else if constexpr ( std::is_move_constructible_v< T > ) {
+        static_assert( std::is_nothrow_move_constructible_v< T >,
+                       "nova::relocate_at: T must be nothrow move constructible" );
+        T* result = ::new ( static_cast< void* >( dest ) ) T( std::move( *source ) );
+        source->~T();
+        return result;
+    } else {
+        T* result = ::new ( static_cast< void* >( dest ) ) T( take( std::move( *source ) ) );
+        source->~T();
+        return result;
+    }
+}
+
+/**
+ * @brief A contiguous, growable sequence of non_null<P>.
+ *
+ * std::vector cannot hold move-only wrappers such as non_null<std::unique_ptr<T>>
+ * because their move constructor is deleted. non_null_vector never moves its
+ * elements: reallocation and erase relocate them via relocate_at (a memcpy of
+ * the pointers for trivially relocatable P), so moved-from nulls are never
+ * visible and every element access is branch-free.
+ *
+ * @tparam P The pointer type (e.g., T*, std::unique_ptr<T>, std::shared_ptr<T>).
+ */
+template < typename P, typename Allocator = std::allocator< non_null< P > > >
+class non_null_vector
+{
+    using alloc_traits = std::allocator_traits< Allocator >;
+
+public:
+    using value_type      = non_null< P >;
+    using allocator_type  = Allocator;
+    using size_type       = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference       = value_type&;
+    using const_reference = const value_type&;
+    using pointer         = value_type*;
+    using const_pointer   = const value_type*;
+    using iterator        = value_type*;
+    using const_iterator  = const value_type*;
+
+    static_assert( std::is_same_v< typename alloc_traits::value_type, value_type >,
+                   "nova::non_null_vector: allocator must allocate non_null<P>" );
+    static_assert( std::is_same_v< typename alloc_traits::pointer, value_type* >,
+                   "nova::non_null_vector: fancy allocator pointers are not supported" );
+
+    non_null_vector() noexcept( noexcept( Allocator() ) ) = default;
+
+    explicit non_null_vector( const Allocator& alloc ) noexcept :
+        alloc_( alloc )
+    {}
+
+    non_null_vector( const non_null_vector& other )
+        requires detail::copyable_pointer< P >
+        :
+        alloc_( alloc_traits::select_on_container_copy_construction( other.alloc_ ) )
+    {
+        reserve( other.size() );
+        for ( const value_type& v : other )
+            push_back( v );
+    }
+
+    non_null_vector( non_null_vector&& other ) noexcept :
+        alloc_( std::move( other.alloc_ ) ),
+        begin_( std::exchange( other.begin_, nullptr ) ),
+        end_( std::exchange( other.end_, nullptr ) ),
+        cap_( std::exchange( other.cap_, nullptr ) )
+    {}
+
+    non_null_vector& operator=( const non_null_vector& other )
+        requires detail::copyable_pointer< P >
+    {
+        if ( this != &other ) {
+            non_null_vector tmp( other );
+            swap( tmp );
+        }
+        return *this;
+    }
+
+    non_null_vector& operator=( non_null_vector&& other ) noexcept
+    {
+        static_assert( alloc_traits::propagate_on_container_move_assignment::value
+                           || alloc_traits::is_always_equal::value,
+                       "nova::non_null_vector: allocator must propagate on move assignment or always compare equal" );
+        if ( this != &other ) {
+            release();
+            if constexpr ( alloc_traits::propagate_on_container_move_assignment::value )
+                alloc_ = std::move( other.alloc_ );
+            begin_ = std::exchange( other.begin_, nullptr );
+            end_   = std::exchange( other.end_, nullptr );
+            cap_   = std::exchange( other.cap_, nullptr );
+        }
+        return *this;
+    }
+
+    ~non_null_vector()
+    {
+        release();
+    }
+
+    allocator_type get_allocator() const noexcept
+    {
+        return alloc_;
+    }
+
+    // --- element access ----------------------------------------------------------
+
+    reference operator[]( size_type i ) noexcept
+    {
+        assert( i < size() && "nova::non_null_vector: index out of range" );
+        return begin_[ i ];
+    }
+
+    const_reference operator[]( size_type i ) const noexcept
+    {
+        assert( i < size() && "nova::non_null_vector: index out of range" );
+        return begin_[ i ];
+    }
+
+    reference front() noexcept
+    {
+        return ( *this )[ 0 ];
+    }
+    const_reference front() const noexcept
+    {
+        return ( *this )[ 0 ];
+    }
+
+    reference back() noexcept
+    {
+        return ( *this )[ size() - 1 ];
+    }
+    const_reference back() const noexcept
+    {
+        return ( *this )[ size() - 1 ];
+    }
+
+    pointer data() noexcept
+    {
+        return begin_;
+    }
+    const_pointer data() const noexcept
+    {
+        return begin_;
+    }
+
+    // --- iterators -------------------------------------------------------------
+
+    iterator begin() noexcept
+    {
+        return begin_;
+    }
+    const_iterator begin() const noexcept
+    {
+        return begin_;
+    }
+    iterator end() noexcept
+    {
+        return end_;
+    }
+    const_iterator end() const noexcept
+    {
+        return end_;
+    }
+
+    // --- capacity --------------------------------------------------------------
+
+    bool empty() const noexcept
+    {
+        return begin_ == end_;
+    }
+
+    size_type size() const noexcept
+    {
+        return static_cast< size_type >( end_ - begin_ );
+    }
+
+    size_type capacity() const noexcept
+    {
+        return static_cast< size_type >( cap_ - begin_ );
+    }
+
+    /**
+     * @brief Grows the capacity to at least n elements, relocating the
+     *        existing elements into the new storage.
+     */
+    void reserve( size_type n )
+    {
+        if ( n > capacity() )
+            reallocate( n );
+    }
+
+    // --- modifiers -------------------------------------------------------------
+
+    /**
+     * @brief Constructs a non_null<P> in place at the end. Args must not be null.
+     */
+    template < typename... Args >
+    reference emplace_back( Args&&... args )
+    {
+        if ( end_ == cap_ )
+            return grow_and_emplace_back( std::forward< Args >( args )... );
+        alloc_traits::construct( alloc_, end_, std::forward< Args >( args )... );
+        return *end_++;
+    }
+
+    void push_back( const value_type& value )
+        requires detail::copyable_pointer< P >
+    {
+        emplace_back( value );
+    }
+
+    /**
+     * @brief Appends value. Move-only pointers are taken out of value via
+     *        take(); copyable ones are moved, leaving value usable.
+     */
+    void push_back( value_type&& value )
+    {
+        if constexpr ( detail::copyable_pointer< P > )
+            emplace_back( std::move( value ) );
+        else
+            emplace_back( take( std::move( value ) ) );
+    }
+
+    /**
+     * @brief Removes the last element. The vector must not be empty.
+     */
+    void pop_back() noexcept
+    {
+        assert( !empty() && "nova::non_null_vector: pop_back on empty vector" );
+        alloc_traits::destroy( alloc_, --end_ );
+    }
+
+    /**
+     * @brief Removes the last element and returns its underlying pointer,
+     *        like take() on the element. The vector must not be empty.
+     */
+    P take_back() noexcept
+    {
+        assert( !empty() && "nova::non_null_vector: take_back on empty vector" );
+        --end_;
+        P result = take( std::move( *end_ ) );
+        alloc_traits::destroy( alloc_, end_ );
+        return result;
+    }
+
+    /**
+     * @brief Removes the element at pos, relocating the tail down by one.
+     * @return Iterator to the element following the removed one.
+     */
+    iterator erase( const_iterator pos ) noexcept
+    {
+        assert( pos >= begin_ && pos < end_ && "nova::non_null_vector: erase position out of range" );
+        iterator p = begin_ + ( pos - begin_ );
+        alloc_traits::destroy( alloc_, p );
+        relocate_range( p + 1, end_, p );
+        --end_;
+        return p;
+    }
+
+    /**
+     * @brief Destroys all elements. The capacity is retained.
+     */
+    void clear() noexcept
+    {
+        while ( end_ != begin_ )
+            alloc_traits::destroy( alloc_, --end_ );
+    }
+
+    void swap( non_null_vector& other ) noexcept
+    {
+        if constexpr ( alloc_traits::propagate_on_container_swap::value ) {
+            using std::swap;
+            swap( alloc_, other.alloc_ );
+        }
+        std::swap( begin_, other.begin_ );
+        std::swap( end_, other.end_ );
+        std::swap( cap_, other.cap_ );
+    }
+
+    /**
+     * @brief Sorts the elements in place with respect to comp.
+     *
+     * Move-only elements cannot be sorted by std::sort; they are sorted by a
+     * heapsort that only swaps elements, so every element stays non-null.
+     */
+    template < typename Compare = std::less<> >
+    void sort( Compare comp = {} )
+    {
+        if constexpr ( std::is_move_constructible_v< value_type > && std::is_move_assignable_v< value_type > ) {
+            std::sort( begin_, end_, comp );
+        } else {
+            const size_type n         = size();
+            auto            sift_down = [ & ]( size_type root, size_type heap_end ) {
+                for ( ;; ) {
+                    size_type child = 2 * root + 1;
+                    if ( child >= heap_end )
+                        return;
+                    if ( child + 1 < heap_end && comp( begin_[ child ], begin_[ child + 1 ] ) )
+                        ++child;
+                    if ( !comp( begin_[ root ], begin_[ child ] ) )
+                        return;
+                    begin_[ root ].swap( begin_[ child ] );
+                    root = child;
+                }
+            };
+
+            for ( size_type i = n / 2; i-- != 0; )
+                sift_down( i, n );
+            for ( size_type heap_end = n; heap_end > 1; --heap_end ) {
+                begin_[ 0 ].swap( begin_[ heap_end - 1 ] );
+                sift_down( 0, heap_end - 1 );
+            }
+        }
+    }
+
+private:
+    static void relocate_range( pointer first, pointer last, pointer dest ) noexcept
+    {
+        if constexpr ( is_trivially_relocatable_v< value_type > ) {
+            if ( first != last )
+                std::memmove( static_cast< void* >( dest ),
+                              static_cast< const void* >( first ),
+                              static_cast< std::size_t >( last - first ) * sizeof( value_type ) );
+        } else {
+            for ( ; first != last; ++first, ++dest )
+                relocate_at( first, dest );
+        }
+    }
+
+    size_type next_capacity() const noexcept
+    {
+        return capacity() ? 2 * capacity() : 4;
+    }
+
+    // Owns a freshly allocated buffer until released.
+    struct buffer_guard
+    {
+        Allocator& alloc;
+        pointer    ptr;
+        size_type  n;
+
+        ~buffer_guard()
+        {
+            if ( ptr )
+                alloc_traits::deallocate( alloc, ptr, n );
+        }
+    };
+
+    void adopt( buffer_guard& buffer, size_type count ) noexcept
+    {
+        relocate_range( begin_, end_, buffer.ptr );
+        if ( begin_ )
+            alloc_traits::deallocate( alloc_, begin_, capacity() );
+        begin_     = buffer.ptr;
+        end_       = begin_ + count;
+        cap_       = begin_ + buffer.n;
+        buffer.ptr = nullptr;
+    }
+
+    void reallocate( size_type n )
+    {
+        buffer_guard buffer { alloc_, alloc_traits::allocate( alloc_, n ), n };
+        adopt( buffer, size() );
+    }
+
+    template < typename... Args >
+    reference grow_and_emplace_back( Args&&... args )
+    {
+        const size_type count = size();
+        const size_type n     = next_capacity();
+        buffer_guard    buffer { alloc_, alloc_traits::allocate( alloc_, n ), n };
+
+        // Construct the new element first: args may refer to existing elements.
+        alloc_traits::construct( alloc_, buffer.ptr + count, std::forward< Args >( args )... );
+        adopt( buffer, count + 1 );
+        return *( end_ - 1 );
+    }
+
+    void release() noexcept
+    {
+        clear();
+        if ( begin_ )
+            alloc_traits::deallocate( alloc_, begin_, capacity() );
+        begin_ = end_ = cap_ = nullptr;
+    }
+
+    [[no_unique_address]] Allocator alloc_;
+    pointer                         begin_ = nullptr;
+    pointer                         end_   = nullptr;
+    pointer                         cap_   = nullptr;
+};
+
+/**
+ * @brief ADL swap for non_null_vector.
+ */
+template < typename P, typename Allocator >
+void swap( non_null_vector< P, Allocator >& lhs, non_null_vector< P, Allocator >& rhs ) noexcept
+{
+    lhs.swap( rhs );
+}
+
+} // namespace nova
+
+#include <nova/non_null/detail/epilogue.hpp>
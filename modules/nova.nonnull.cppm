@@ -0,0 +1,132 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2026 Tim Blechmann
+
+// Module interface unit of nova.nonnull. The headers are included in the global
+// module fragment and their public names are re-exported, so a program may mix
+// `import nova.nonnull;` and `#include <nova/non_null.hpp>` and still sees the
+// same entities. Configuration macros (NOVA_CONTRACT_POLICY,
+// NOVA_INSTRUMENTATION) do not cross the import: set them on the module target.
+
+module;
+
+#include <nova/non_null.hpp>
+
+export module nova.nonnull;
+
+export namespace nova {
+
+// core
+using nova::contract_assert;
+using nova::contract_default;
+using nova::contract_handler;
+using nova::contract_policy;
+using nova::contract_throw;
+using nova::contract_trap;
+using nova::contract_trust;
+using nova::contract_violation;
+using nova::contract_violation_error;
+using nova::contract_violation_handler;
+using nova::get_contract_violation_handler;
+using nova::get_instrumentation_counters;
+using nova::instrumentation_counters;
+using nova::instrumentation_enabled;
+using nova::is_trivially_relocatable;
+using nova::is_trivially_relocatable_v;
+using nova::make_non_null_shared;
+using nova::make_non_null_unique;
+using nova::make_static_non_null;
+using nova::non_null;
+using nova::non_null_borrow;
+using nova::non_null_of;
+using nova::non_null_shared_ptr;
+using nova::non_null_unique_ptr;
+using nova::reset_instrumentation_counters;
+using nova::set_contract_violation_handler;
+using nova::swap;
+
+// optional
+using nova::optional_non_null;
+using nova::try_make_non_null;
+using nova::try_make_non_null_shared;
+using nova::try_make_non_null_unique;
+using nova::try_make_optional_non_null;
+
+// span
+using nova::find_first_null;
+using nova::non_empty_span;
+using nova::non_null_range;
+using nova::non_null_span;
+using nova::try_make_non_empty_span;
+using nova::try_make_non_null_range;
+
+// allocator
+using nova::allocate_non_null_shared;
+using nova::allocate_non_null_unique;
+using nova::allocate_non_null_unique_for_overwrite;
+using nova::allocator_delete;
+using nova::non_null_allocated_unique_ptr;
+using nova::non_null_pmr_unique_ptr;
+#if defined( __cpp_lib_smart_ptr_for_overwrite ) && __cpp_lib_smart_ptr_for_overwrite >= 202002L
+using nova::allocate_non_null_shared_for_overwrite;
+#endif
+
+// smart_ptr
+using nova::intrusive_ptr;
+using nova::intrusive_ref_counter;
+using nova::intrusive_thread_safe_counter;
+using nova::intrusive_thread_unsafe_counter;
+using nova::make_non_null_intrusive;
+using nova::make_non_null_trivial_unique;
+using nova::non_null_box;
+using nova::non_null_intrusive_ptr;
+using nova::non_null_trivial_unique_ptr;
+using nova::non_null_weak_ptr;
+
+// vector
+using nova::non_null_vector;
+using nova::relocate_at;
+
+// hash
+using nova::owner_less;
+using nova::pointer_equal;
+using nova::pointer_hash;
+#if defined( __cpp_lib_smart_ptr_owner_equality ) && __cpp_lib_smart_ptr_owner_equality >= 202306L
+using nova::owner_equal;
+using nova::owner_hash;
+#endif
+
+// flat_table
+using nova::non_null_flat_map;
+using nova::non_null_flat_set;
+
+// atomic, tagged_ptr
+using nova::non_null_atomic;
+using nova::non_null_atomic_shared_ptr;
+using nova::non_null_atomic_tagged_ptr;
+using nova::non_null_tagged_ptr;
+
+// functional
+using nova::inplace_function;
+using nova::inplace_function_default_capacity;
+using nova::non_null_fn_ptr;
+using nova::non_null_function;
+using nova::non_null_function_ref;
+using nova::non_null_inplace_function;
+#if defined( __cpp_lib_move_only_function ) && __cpp_lib_move_only_function >= 202110L
+using nova::non_null_move_only_function;
+#    if defined( __cpp_lib_copyable_function )
+using nova::non_null_copyable_function;
+#    endif
+
+// task_queue
+using nova::non_null_task_queue;
+using nova::task_queue_default_task_capacity;
+#endif
+
+// coroutine
+using nova::non_null_coroutine_handle;
+#if defined( __cpp_lib_move_only_function ) && __cpp_lib_move_only_function >= 202110L
+using nova::non_null_continuation;
+#endif
+
+} // namespace nova
@@ -0,0 +1,37 @@
+# SPDX-License-Identifier: MIT
+# SPDX-FileCopyrightText: 2026 Tim Blechmann
+
+# Checks the assembly of the codegen probes and controls.
+#
+# Usage: cmake -DPROBES=<probes.s> -DCONTROLS=<controls.s> -DPROBE_SOURCE=<codegen_probes.cpp>
+#              -DSTAMP=<file> -P check_codegen.cmake
+
+set(branch_regex "nova_codegen_null_branch_[A-Za-z_]+|bad_function_call")
+
+file(STRINGS "${PROBES}" probe_hits REGEX "${branch_regex}")
+if (probe_hits)
+    string(REGEX MATCHALL "${branch_regex}" branches "${probe_hits}")
+    list(REMOVE_DUPLICATES branches)
+    list(JOIN branches "\n  " branches)
+    message(FATAL_ERROR
+        "nova codegen regression: branches that the non_null hints should eliminate "
+        "are still present in ${PROBES}:\n  ${branches}")
+endif()
+
+# Every marker declared by the probes must survive in the controls; otherwise
+# its probe would pass whether or not the hint works.
+file(STRINGS "${PROBE_SOURCE}" marker_decls REGEX "^void nova_codegen_null_branch_[A-Za-z_]+\\(\\);")
+string(REGEX MATCHALL "nova_codegen_null_branch_[A-Za-z_]+" markers "${marker_decls}")
+if (NOT markers)
+    message(FATAL_ERROR "nova codegen check is broken: no markers declared in ${PROBE_SOURCE}")
+endif()
+
+foreach(expected ${markers} bad_function_call)
+    file(STRINGS "${CONTROLS}" control_hits REGEX "${expected}")
+    if (NOT control_hits)
+        message(FATAL_ERROR
+            "nova codegen check is broken: '${expected}' was not found in the controls (${CONTROLS})")
+    endif()
+endforeach()
+
+file(TOUCH "${STAMP}")
@@ -0,0 +1,248 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2026 Tim Blechmann
+
+// Codegen controls: the same shapes as codegen_probes.cpp, written against the
+// nullable counterparts of the wrappers (std types, nova::intrusive_ptr). There
+// is one control per probe, and check_codegen.cmake requires every marker
+// declared in codegen_probes.cpp (and the bad_function_call path) to be
+// present here, so that a broken pattern cannot pass the probes vacuously.
+
+#include <atomic>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <span>
+
+#include <nova/non_null.hpp>
+
+extern "C" {
+void nova_codegen_null_branch_raw_get();
+void nova_codegen_null_branch_static_handle();
+void nova_codegen_null_branch_trap_construct();
+void nova_codegen_null_branch_unique_get();
+void nova_codegen_null_branch_shared_get();
+void nova_codegen_null_branch_fancy_get();
+void nova_codegen_null_branch_shared_arrow();
+void nova_codegen_null_branch_shared_borrow();
+void nova_codegen_null_branch_shared_underlying();
+void nova_codegen_null_branch_intrusive_get();
+void nova_codegen_null_branch_unique_take();
+void nova_codegen_null_branch_shared_take();
+void nova_codegen_null_branch_trivial_unique_take();
+void nova_codegen_null_branch_box_get();
+void nova_codegen_null_branch_optional_deref();
+void nova_codegen_null_branch_span_data();
+void nova_codegen_null_branch_span_empty();
+void nova_codegen_null_branch_atomic_load();
+void nova_codegen_null_branch_tagged_get();
+void nova_codegen_null_branch_atomic_shared_snapshot();
+void nova_codegen_null_branch_fn_ptr_get();
+void nova_codegen_null_branch_coroutine_get();
+}
+
+int control_raw_get( int* raw )
+{
+    if ( !raw )
+        nova_codegen_null_branch_raw_get();
+    return *raw;
+}
+
+// A pointer variable rather than the address of a global, which is known to be
+// non-null.
+int* control_static_target = nullptr;
+
+int control_static_handle()
+{
+    int* p = control_static_target;
+    if ( !p )
+        nova_codegen_null_branch_static_handle();
+    return *p;
+}
+
+int control_trap_construct( int* raw )
+{
+    if ( !raw )
+        nova_codegen_null_branch_trap_construct();
+    return *raw;
+}
+
+int control_unique_get( const std::unique_ptr< int >& p )
+{
+    int* raw = p.get();
+    if ( !raw )
+        nova_codegen_null_branch_unique_get();
+    return *raw;
+}
+
+int control_shared_get( const std::shared_ptr< int >& p )
+{
+    int* raw = p.get();
+    if ( !raw )
+        nova_codegen_null_branch_shared_get();
+    return *raw;
+}
+
+struct control_offset_ptr
+{
+    std::ptrdiff_t offset;
+
+    int* operator->() const noexcept
+    {
+        return offset == 1 ? nullptr : reinterpret_cast< int* >( reinterpret_cast< std::uintptr_t >( this ) + offset );
+    }
+};
+
+int control_fancy_get( const control_offset_ptr& p )
+{
+    int* raw = p.operator->();
+    if ( !raw )
+        nova_codegen_null_branch_fancy_get();
+    return *raw;
+}
+
+int control_shared_arrow( const std::shared_ptr< int >& p )
+{
+    int* raw = p.operator->();
+    if ( !raw )
+        nova_codegen_null_branch_shared_arrow();
+    return *raw;
+}
+
+int control_shared_borrow( const std::shared_ptr< int >& p )
+{
+    int* b = p.get();
+    if ( !b )
+        nova_codegen_null_branch_shared_borrow();
+    return *b;
+}
+
+int control_shared_underlying( const std::shared_ptr< int >& sp )
+{
+    if ( !sp )
+        nova_codegen_null_branch_shared_underlying();
+    return *sp;
+}
+
+struct control_counted : nova::intrusive_ref_counter< control_counted >
+{
+    int value;
+};
+
+int control_intrusive_get( const nova::intrusive_ptr< control_counted >& p )
+{
+    control_counted* raw = p.get();
+    if ( !raw )
+        nova_codegen_null_branch_intrusive_get();
+    return raw->value;
+}
+
+std::unique_ptr< int > control_unique_take( std::unique_ptr< int >&& p )
+{
+    std::unique_ptr< int > up = std::move( p );
+    if ( !up )
+        nova_codegen_null_branch_unique_take();
+    return up;
+}
+
+std::shared_ptr< int > control_shared_take( std::shared_ptr< int >&& p )
+{
+    std::shared_ptr< int > sp = std::move( p );
+    if ( !sp )
+        nova_codegen_null_branch_shared_take();
+    return sp;
+}
+
+std::unique_ptr< int > control_trivial_unique_take( std::unique_ptr< int > p )
+{
+    std::unique_ptr< int > up = std::move( p );
+    if ( !up )
+        nova_codegen_null_branch_trivial_unique_take();
+    return up;
+}
+
+int control_box_get( const std::unique_ptr< int >& b )
+{
+    const int* raw = b.get();
+    if ( !raw )
+        nova_codegen_null_branch_box_get();
+    return *raw;
+}
+
+int control_optional_deref( std::optional< int* > opt )
+{
+    if ( !opt )
+        return 0;
+    int* p = *opt;
+    if ( !p )
+        nova_codegen_null_branch_optional_deref();
+    return *p;
+}
+
+int control_span_data( std::span< const int > s )
+{
+    const int* raw = s.data();
+    if ( !raw )
+        nova_codegen_null_branch_span_data();
+    return *raw;
+}
+
+int control_span_empty( std::span< const int > s )
+{
+    if ( s.size() == 0 || s.begin() == s.end() )
+        nova_codegen_null_branch_span_empty();
+    int sum = 0;
+    for ( int v : s )
+        sum += v;
+    return sum + s.back();
+}
+
+int control_atomic_load( const std::atomic< int* >& a )
+{
+    int* p = a.load( std::memory_order_acquire );
+    if ( !p )
+        nova_codegen_null_branch_atomic_load();
+    return *p;
+}
+
+struct alignas( 8 ) control_tagged_node
+{
+    int value;
+};
+
+int control_tagged_get( std::uintptr_t bits )
+{
+    auto* raw = reinterpret_cast< control_tagged_node* >( bits & ~std::uintptr_t( 7 ) );
+    if ( !raw )
+        nova_codegen_null_branch_tagged_get();
+    return raw->value + static_cast< int >( bits & 7 );
+}
+
+int control_atomic_shared_snapshot( const std::shared_ptr< int >& a )
+{
+    std::shared_ptr< int > snap = a;
+    if ( !snap.get() )
+        nova_codegen_null_branch_atomic_shared_snapshot();
+    return *snap;
+}
+
+int control_fn_ptr_get( int ( *raw )( int ) )
+{
+    if ( !raw )
+        nova_codegen_null_branch_fn_ptr_get();
+    return raw( 1 );
+}
+
+void control_coroutine_get( std::coroutine_handle<> raw )
+{
+    if ( !raw )
+        nova_codegen_null_branch_coroutine_get();
+    raw.resume();
+}
+
+int control_function_call( const std::function< int( int ) >& fn )
+{
+    return fn( 1 );
+}
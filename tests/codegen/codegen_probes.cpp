@@ -0,0 +1,264 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2026 Tim Blechmann
+
+// Codegen probes: compiled to assembly at -O2 -DNDEBUG and checked by
+// check_codegen.cmake. Every probe guards a branch that the nova hints must
+// prove dead with a call to a unique nova_codegen_null_branch_* marker. If any
+// marker, or a bad_function_call path, survives in the assembly, the hint for
+// that probe was lost and the build fails.
+
+#include <cstddef>
+#include <coroutine>
+#include <cstdint>
+#include <memory>
+
+#include <nova/non_null.hpp>
+
+extern "C" {
+void nova_codegen_null_branch_raw_get();
+void nova_codegen_null_branch_static_handle();
+void nova_codegen_null_branch_trap_construct();
+void nova_codegen_null_branch_unique_get();
+void nova_codegen_null_branch_shared_get();
+void nova_codegen_null_branch_fancy_get();
+void nova_codegen_null_branch_shared_arrow();
+void nova_codegen_null_branch_shared_borrow();
+void nova_codegen_null_branch_shared_underlying();
+void nova_codegen_null_branch_intrusive_get();
+void nova_codegen_null_branch_unique_take();
+void nova_codegen_null_branch_shared_take();
+void nova_codegen_null_branch_trivial_unique_take();
+void nova_codegen_null_branch_box_get();
+void nova_codegen_null_branch_optional_deref();
+void nova_codegen_null_branch_span_data();
+void nova_codegen_null_branch_span_empty();
+void nova_codegen_null_branch_atomic_load();
+void nova_codegen_null_branch_tagged_get();
+void nova_codegen_null_branch_atomic_shared_snapshot();
+void nova_codegen_null_branch_fn_ptr_get();
+void nova_codegen_null_branch_coroutine_get();
+}
+
+int probe_raw_get( nova::non_null< int* > p )
+{
+    int* raw = p.get();
+    if ( !raw )
+        nova_codegen_null_branch_raw_get();
+    return *raw;
+}
+
+int probe_static_target = 0;
+
+int probe_static_handle()
+{
+    nova::non_null< int* > p = nova::non_null_of< &probe_static_target > {};
+    if ( !p.get() )
+        nova_codegen_null_branch_static_handle();
+    return *p;
+}
+
+// The trap check itself stays; the branch after it must go.
+int probe_trap_construct( int* raw )
+{
+    nova::non_null< int*, nova::contract_trap > p( raw );
+    if ( !p.get() )
+        nova_codegen_null_branch_trap_construct();
+    return *p;
+}
+
+int probe_unique_get( const nova::non_null_unique_ptr< int >& p )
+{
+    int* raw = p.get();
+    if ( !raw )
+        nova_codegen_null_branch_unique_get();
+    return *raw;
+}
+
+int probe_shared_get( const nova::non_null_shared_ptr< int >& p )
+{
+    int* raw = p.get();
+    if ( !raw )
+        nova_codegen_null_branch_shared_get();
+    return *raw;
+}
+
+// Minimal self-relative pointer: the decoded address is this + offset, which
+// the compiler cannot prove non-null on its own.
+struct probe_offset_ptr
+{
+    using element_type = int;
+
+    std::ptrdiff_t offset;
+
+    static probe_offset_ptr pointer_to( int& r ) noexcept;
+    int*                      operator->() const noexcept
+    {
+        return offset == 1 ? nullptr : reinterpret_cast< int* >( reinterpret_cast< std::uintptr_t >( this ) + offset );
+    }
+    explicit operator bool() const noexcept
+    {
+        return offset != 1;
+    }
+    friend bool operator==( const probe_offset_ptr& p, std::nullptr_t ) noexcept
+    {
+        return p.offset == 1;
+    }
+};
+
+int probe_fancy_get( const nova::non_null< probe_offset_ptr >& p )
+{
+    int* raw = p.get();
+    if ( !raw )
+        nova_codegen_null_branch_fancy_get();
+    return *raw;
+}
+
+int probe_shared_arrow( const nova::non_null_shared_ptr< int >& p )
+{
+    int* raw = p.operator->();
+    if ( !raw )
+        nova_codegen_null_branch_shared_arrow();
+    return *raw;
+}
+
+// Borrowing must neither re-check the pointer nor touch the reference count.
+int probe_shared_borrow( const nova::non_null_shared_ptr< int >& p )
+{
+    nova::non_null< int* > b = p.borrow();
+    if ( !b.get() )
+        nova_codegen_null_branch_shared_borrow();
+    return *b;
+}
+
+int probe_shared_underlying( const nova::non_null_shared_ptr< int >& p )
+{
+    const std::shared_ptr< int >& sp = p.underlying();
+    if ( !sp )
+        nova_codegen_null_branch_shared_underlying();
+    return *sp;
+}
+
+struct probe_counted : nova::intrusive_ref_counter< probe_counted >
+{
+    int value;
+};
+
+int probe_intrusive_get( const nova::non_null_intrusive_ptr< probe_counted >& p )
+{
+    probe_counted* raw = p.get();
+    if ( !raw )
+        nova_codegen_null_branch_intrusive_get();
+    return raw->value;
+}
+
+std::unique_ptr< int > probe_unique_take( nova::non_null_unique_ptr< int >&& p )
+{
+    std::unique_ptr< int > up = take( std::move( p ) );
+    if ( !up )
+        nova_codegen_null_branch_unique_take();
+    return up;
+}
+
+std::shared_ptr< int > probe_shared_take( nova::non_null_shared_ptr< int >&& p )
+{
+    std::shared_ptr< int > sp = take( std::move( p ) );
+    if ( !sp )
+        nova_codegen_null_branch_shared_take();
+    return sp;
+}
+
+std::unique_ptr< int > probe_trivial_unique_take( nova::non_null_trivial_unique_ptr< int > p )
+{
+    std::unique_ptr< int > up = take( std::move( p ) );
+    if ( !up )
+        nova_codegen_null_branch_trivial_unique_take();
+    return up;
+}
+
+int probe_box_get( const nova::non_null_box< int >& b )
+{
+    const int* raw = b.get();
+    if ( !raw )
+        nova_codegen_null_branch_box_get();
+    return *raw;
+}
+
+int probe_optional_deref( nova::optional_non_null< int* > opt )
+{
+    if ( !opt )
+        return 0;
+    nova::non_null< int* > p = *opt;
+    if ( !p.get() )
+        nova_codegen_null_branch_optional_deref();
+    return *p;
+}
+
+int probe_span_data( nova::non_null_span< const int > s )
+{
+    const int* raw = s.begin();
+    if ( !raw )
+        nova_codegen_null_branch_span_data();
+    return *raw;
+}
+
+// The empty-prologue check of the range loop must go as well.
+int probe_span_empty( nova::non_empty_span< const int > s )
+{
+    if ( s.size() == 0 || s.begin() == s.end() )
+        nova_codegen_null_branch_span_empty();
+    int sum = 0;
+    for ( int v : s )
+        sum += v;
+    return sum + s.back();
+}
+
+int probe_atomic_load( const nova::non_null_atomic< int* >& a )
+{
+    nova::non_null< int* > p = a.load( std::memory_order_acquire );
+    if ( !p.get() )
+        nova_codegen_null_branch_atomic_load();
+    return *p;
+}
+
+struct alignas( 8 ) probe_tagged_node
+{
+    int value;
+};
+
+int probe_tagged_get( nova::non_null_tagged_ptr< probe_tagged_node, 3 > p )
+{
+    probe_tagged_node* raw = p.get();
+    if ( !raw )
+        nova_codegen_null_branch_tagged_get();
+    return raw->value + static_cast< int >( p.tag() );
+}
+
+int probe_atomic_shared_snapshot( const nova::non_null_atomic_shared_ptr< int >& a )
+{
+    auto snap = a.snapshot();
+    if ( !snap.get() )
+        nova_codegen_null_branch_atomic_shared_snapshot();
+    return *snap;
+}
+
+int probe_fn_ptr_get( nova::non_null_fn_ptr< int( int ) > fn )
+{
+    int ( *raw )( int ) = fn.get();
+    if ( !raw )
+        nova_codegen_null_branch_fn_ptr_get();
+    return raw( 1 );
+}
+
+void probe_coroutine_get( nova::non_null_coroutine_handle<> h )
+{
+    std::coroutine_handle<> raw = h.get();
+    if ( !raw )
+        nova_codegen_null_branch_coroutine_get();
+    raw.resume();
+}
+
+// Must not contain a bad_function_call path.
+int probe_function_call( const nova::non_null_function< int( int ) >& fn )
+{
+    return fn( 1 );
+}
@@ -0,0 +1,90 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2026 Tim Blechmann
+
+// Built as its own executable with NOVA_INSTRUMENTATION=1: the setting must be
+// the same in every translation unit of a program.
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <thread>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <nova/non_null.hpp>
+
+static_assert( nova::instrumentation_enabled, "this test must be compiled with NOVA_INSTRUMENTATION=1" );
+
+TEST_CASE( "instrumentation counts pointer wrapper events", "[instrumentation]" )
+{
+    nova::reset_instrumentation_counters();
+
+    int                    value = 1;
+    nova::non_null< int* > a( &value );
+    nova::non_null< int* > b = a;
+    b                        = a;
+
+    nova::instrumentation_counters c = nova::get_instrumentation_counters();
+    CHECK( c.constructions == 1 );
+    CHECK( c.copies == 2 );
+    CHECK( c.takes == 0 );
+
+    auto up = nova::make_non_null_unique< int >( 2 );
+    auto nn = nova::non_null( take( std::move( up ) ) );
+
+    c = nova::get_instrumentation_counters();
+    CHECK( c.constructions == 3 );
+    CHECK( c.takes == 1 );
+    CHECK( *nn == 2 );
+
+    nova::reset_instrumentation_counters();
+    c = nova::get_instrumentation_counters();
+    CHECK( c.constructions == 0 );
+    CHECK( c.copies == 0 );
+}
+
+TEST_CASE( "instrumentation classifies stored callables", "[instrumentation]" )
+{
+    nova::reset_instrumentation_counters();
+
+    nova::non_null_function< int() > small( [] {
+        return 1;
+    } );
+
+    std::array< int, 32 >            big_state {};
+    nova::non_null_function< int() > big( [ big_state ] {
+        return big_state[ 0 ];
+    } );
+
+    nova::non_null_inplace_function< int() > inplace( [] {
+        return 3;
+    } );
+
+    nova::instrumentation_counters c = nova::get_instrumentation_counters();
+    CHECK( c.constructions == 3 );
+#if defined( __cpp_rtti )
+    CHECK( c.inline_callables == 2 );
+    CHECK( c.heap_callables == 1 );
+#endif
+
+    auto fn = take( std::move( big ) );
+    CHECK( nova::get_instrumentation_counters().takes == 1 );
+    CHECK( fn() == 0 );
+    CHECK( small() + inplace() == 4 );
+}
+
+TEST_CASE( "instrumentation counters are per thread", "[instrumentation][thread]" )
+{
+    nova::reset_instrumentation_counters();
+
+    int           value               = 0;
+    std::uint64_t other_constructions = 0;
+    std::thread( [ & ] {
+        nova::non_null< int* > p( &value );
+        other_constructions = nova::get_instrumentation_counters().constructions;
+    } ).join();
+
+    CHECK( other_constructions == 1 );
+    CHECK( nova::get_instrumentation_counters().constructions == 0 );
+}
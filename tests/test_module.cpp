@@ -0,0 +1,41 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2026 Tim Blechmann
+
+// Built only with NOVA_BUILD_MODULE: the wrappers are used through the
+// nova.nonnull module, without including any nova header.
+
+#include <memory>
+#include <unordered_set>
+#include <utility>
+
+#include <catch2/catch_test_macros.hpp>
+
+import nova.nonnull;
+
+TEST_CASE( "module exports the pointer wrappers", "[module]" )
+{
+    int                    value = 1;
+    nova::non_null< int* > p     = &value;
+    CHECK( *p == 1 );
+
+    auto up = nova::make_non_null_unique< int >( 2 );
+    CHECK( *take( std::move( up ) ) == 2 );
+
+    auto opt = nova::try_make_non_null( static_cast< int* >( nullptr ) );
+    CHECK( !opt.has_value() );
+
+    std::unordered_set< nova::non_null< int* > > set { p };
+    CHECK( set.contains( p ) );
+}
+
+TEST_CASE( "module exports the callable wrappers", "[module]" )
+{
+    nova::non_null_function< int( int ) > fn = []( int x ) {
+        return x + 1;
+    };
+    nova::non_null_fn_ptr< int( int ) > ptr = []( int x ) {
+        return x * 2;
+    };
+    CHECK( fn( 1 ) == 2 );
+    CHECK( ptr( 2 ) == 4 );
+}
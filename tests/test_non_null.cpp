@@ -1,8 +1,22 @@
 // SPDX-License-Identifier: MIT
 // SPDX-FileCopyrightText: 2026 Tim Blechmann
 
+#include <atomic>
+#include <cstdint>
+#include <cstring>
 #include <memory>
+#include <memory_resource>
+#include <optional>
+#include <set>
+#include <source_location>
+#include <span>
+#include <stdexcept>
 #include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 #include <catch2/catch_template_test_macros.hpp>
 #include <catch2/catch_test_macros.hpp>
@@ -494,3 +508,1724 @@ TEST_CASE( "move-only types do not support implicit move", "[move-only][unique_p
     // Note: Attempting nn1 after take() is UB; cannot be tested here.
     // The compiler prevents casual use via move constructor deletion.
 }
+
+TEMPLATE_TEST_CASE( "optional_non_null", "[optional_non_null]", int*, std::unique_ptr< int >, std::shared_ptr< int > )
+{
+    using Ptr = TestType;
+    int val   = 42;
+
+    static_assert( sizeof( nova::optional_non_null< Ptr > ) == sizeof( Ptr ) );
+
+    SECTION( "default construction is empty" )
+    {
+        nova::optional_non_null< Ptr > opt;
+        CHECK_FALSE( opt.has_value() );
+        CHECK_FALSE( static_cast< bool >( opt ) );
+        CHECK( opt == std::nullopt );
+        CHECK( opt.get() == nullptr );
+    }
+
+    SECTION( "construction from null pointer is empty" )
+    {
+        nova::optional_non_null< Ptr > opt( PtrHelper< Ptr >::null() );
+        CHECK_FALSE( opt.has_value() );
+    }
+
+    SECTION( "construction from pointer is engaged" )
+    {
+        nova::optional_non_null< Ptr > opt( PtrHelper< Ptr >::make( val ) );
+        REQUIRE( opt.has_value() );
+        CHECK( *opt.operator->() == 42 );
+        CHECK( *opt.get() == 42 );
+    }
+
+    SECTION( "value() of rvalue moves out a non_null" )
+    {
+        nova::optional_non_null< Ptr > opt( PtrHelper< Ptr >::make( val ) );
+        auto                           nn = std::move( opt ).value();
+        static_assert( std::is_same_v< decltype( nn ), nova::non_null< Ptr > > );
+        CHECK( *nn == 42 );
+    }
+
+    SECTION( "operator* of rvalue moves out a non_null" )
+    {
+        nova::optional_non_null< Ptr > opt( PtrHelper< Ptr >::make( val ) );
+        nova::non_null< Ptr >          nn = *std::move( opt );
+        CHECK( *nn == 42 );
+    }
+
+    SECTION( "value() of empty optional throws" )
+    {
+        nova::optional_non_null< Ptr > opt;
+        CHECK_THROWS_AS( std::move( opt ).value(), std::bad_optional_access );
+    }
+
+    SECTION( "reset and assignment from nullopt" )
+    {
+        nova::optional_non_null< Ptr > opt( PtrHelper< Ptr >::make( val ) );
+        opt.reset();
+        CHECK_FALSE( opt.has_value() );
+
+        nova::optional_non_null< Ptr > opt2( PtrHelper< Ptr >::make( val ) );
+        opt2 = std::nullopt;
+        CHECK_FALSE( opt2.has_value() );
+    }
+
+    SECTION( "move leaves a valid optional" )
+    {
+        nova::optional_non_null< Ptr > opt1( PtrHelper< Ptr >::make( val ) );
+        nova::optional_non_null< Ptr > opt2( std::move( opt1 ) );
+        CHECK( opt2.has_value() );
+        CHECK( *opt2.get() == 42 );
+    }
+
+    SECTION( "swap" )
+    {
+        nova::optional_non_null< Ptr > opt1( PtrHelper< Ptr >::make( val ) );
+        nova::optional_non_null< Ptr > opt2;
+        using std::swap;
+        swap( opt1, opt2 );
+        CHECK_FALSE( opt1.has_value() );
+        CHECK( opt2.has_value() );
+    }
+}
+
+TEST_CASE( "optional_non_null - copyable pointers", "[optional_non_null]" )
+{
+    SECTION( "value() and operator* of lvalue copy the pointer" )
+    {
+        int                             x = 7;
+        nova::optional_non_null< int* > opt( &x );
+        nova::non_null< int* >          nn = opt.value();
+        CHECK( nn.get() == &x );
+        CHECK( ( *opt ).get() == &x );
+        CHECK( opt.has_value() );
+    }
+
+    SECTION( "construction from non_null" )
+    {
+        auto                    nn = nova::make_non_null_shared< int >( 3 );
+        nova::optional_non_null opt( nn );
+        static_assert( std::is_same_v< decltype( opt ), nova::optional_non_null< std::shared_ptr< int > > > );
+        CHECK( opt.has_value() );
+        CHECK( nn.use_count() == 2 );
+        CHECK( opt == nova::optional_non_null< std::shared_ptr< int > >( nn ) );
+    }
+
+    SECTION( "construction from non_null<unique_ptr> takes ownership" )
+    {
+        auto                                              nn = nova::make_non_null_unique< int >( 5 );
+        nova::optional_non_null< std::unique_ptr< int > > opt( take( std::move( nn ) ) );
+        CHECK( *opt.get() == 5 );
+
+        auto                                              nn2 = nova::make_non_null_unique< int >( 6 );
+        nova::optional_non_null< std::unique_ptr< int > > opt2( std::move( nn2 ) );
+        CHECK( *opt2.get() == 6 );
+    }
+}
+
+TEMPLATE_TEST_CASE(
+    "try_make_optional_non_null factory", "[optional_non_null]", int*, std::unique_ptr< int >, std::shared_ptr< int > )
+{
+    using Ptr = TestType;
+
+    SECTION( "non-null case" )
+    {
+        int  val = 5;
+        auto opt = nova::try_make_optional_non_null( PtrHelper< Ptr >::make( val ) );
+        static_assert( std::is_same_v< decltype( opt ), nova::optional_non_null< Ptr > > );
+        CHECK( opt.has_value() );
+        CHECK( *std::move( opt ).value() == 5 );
+    }
+
+    SECTION( "null case" )
+    {
+        auto opt = nova::try_make_optional_non_null( PtrHelper< Ptr >::null() );
+        CHECK_FALSE( opt.has_value() );
+    }
+}
+
+TEST_CASE( "try_make_non_null_unique / try_make_non_null_shared factories", "[optional_non_null][factory]" )
+{
+    auto u = nova::try_make_non_null_unique< std::string >( "hello" );
+    static_assert( std::is_same_v< decltype( u ), nova::optional_non_null< std::unique_ptr< std::string > > > );
+    REQUIRE( u.has_value() );
+    CHECK( *u->c_str() == 'h' );
+
+    auto s = nova::try_make_non_null_shared< std::string >( "world" );
+    static_assert( std::is_same_v< decltype( s ), nova::optional_non_null< std::shared_ptr< std::string > > > );
+    REQUIRE( s.has_value() );
+    CHECK( ( *s )->size() == 5 );
+}
+
+TEST_CASE( "std::hash for non_null", "[hash]" )
+{
+    int                    x = 1;
+    nova::non_null< int* > p( &x );
+    CHECK( std::hash< nova::non_null< int* > > {}( p ) == nova::pointer_hash {}( &x ) );
+
+    auto s = nova::make_non_null_shared< int >( 2 );
+    auto u = nova::make_non_null_unique< int >( 3 );
+    CHECK( std::hash< nova::non_null_shared_ptr< int > > {}( s ) == nova::pointer_hash {}( s.get() ) );
+    CHECK( std::hash< nova::non_null_unique_ptr< int > > {}( u ) == nova::pointer_hash {}( u.get() ) );
+
+    std::unordered_set< nova::non_null_shared_ptr< int > > set;
+    set.insert( s );
+    CHECK( set.count( s ) == 1 );
+    CHECK( set.count( nova::make_non_null_shared< int >( 2 ) ) == 0 );
+
+    nova::optional_non_null< int* > opt( &x );
+    CHECK( std::hash< nova::optional_non_null< int* > > {}( opt ) == nova::pointer_hash {}( &x ) );
+}
+
+TEST_CASE( "pointer_hash / pointer_equal are transparent", "[hash]" )
+{
+    auto s     = nova::make_non_null_shared< int >( 1 );
+    int* raw   = s.get();
+    auto other = std::make_shared< int >( 2 );
+
+    nova::pointer_hash  hash;
+    nova::pointer_equal equal;
+    CHECK( hash( s ) == hash( raw ) );
+    CHECK( hash( s ) == hash( s.underlying() ) );
+    CHECK( equal( s, raw ) );
+    CHECK( equal( raw, s.underlying() ) );
+    CHECK_FALSE( equal( s, other ) );
+
+    auto u = std::make_unique< int >( 3 );
+    CHECK( hash( u ) == hash( u.get() ) );
+    CHECK( equal( u, u.get() ) );
+
+#if defined( __cpp_lib_generic_unordered_lookup ) && __cpp_lib_generic_unordered_lookup >= 201811L
+    std::unordered_map< nova::non_null_shared_ptr< int >, int, nova::pointer_hash, nova::pointer_equal > map;
+    map.emplace( s, 42 );
+
+    // heterogeneous lookup with a raw pointer does not touch the reference count
+    const long count_before = s.use_count();
+    auto       it           = map.find( raw );
+    REQUIRE( it != map.end() );
+    CHECK( it->second == 42 );
+    CHECK( s.use_count() == count_before );
+    CHECK( map.find( other.get() ) == map.end() );
+#endif
+}
+
+TEST_CASE( "owner_less is transparent across non_null and std smart pointers", "[hash][shared_ptr]" )
+{
+    auto                   nn = nova::make_non_null_shared< int >( 1 );
+    std::shared_ptr< int > sp = nn.underlying();
+    std::weak_ptr< int >   wp = sp;
+
+    nova::owner_less less;
+    CHECK_FALSE( less( nn, sp ) );
+    CHECK_FALSE( less( sp, nn ) );
+    CHECK_FALSE( less( nn, wp ) );
+    CHECK_FALSE( less( wp, nn ) );
+
+    std::set< nova::non_null_shared_ptr< int >, nova::owner_less > set;
+    set.insert( nn );
+    CHECK( set.count( wp ) == 1 );
+
+#if defined( __cpp_lib_smart_ptr_owner_equality ) && __cpp_lib_smart_ptr_owner_equality >= 202306L
+    CHECK( nova::owner_hash {}( nn ) == nova::owner_hash {}( wp ) );
+    CHECK( nova::owner_equal {}( nn, wp ) );
+#endif
+}
+
+// =============================================================================
+// non_null_weak_ptr
+// =============================================================================
+
+namespace {
+
+struct Observer
+{
+    int id;
+};
+
+struct DerivedObserver : Observer
+{};
+
+} // namespace
+
+static_assert( sizeof( nova::non_null_weak_ptr< int > ) == sizeof( std::weak_ptr< int > ) );
+static_assert( sizeof( decltype( std::declval< nova::non_null_weak_ptr< int > >().lock() ) )
+               == sizeof( std::shared_ptr< int > ) );
+static_assert( !std::is_default_constructible_v< nova::non_null_weak_ptr< int > > );
+static_assert( !std::is_constructible_v< nova::non_null_weak_ptr< int >, std::nullptr_t > );
+static_assert( !std::is_constructible_v< nova::non_null_weak_ptr< int >, std::shared_ptr< int > > );
+static_assert( nova::is_trivially_relocatable_v< nova::non_null_weak_ptr< int > > );
+
+TEST_CASE( "non_null_weak_ptr", "[weak_ptr][shared_ptr]" )
+{
+    auto                    owner = nova::make_non_null_shared< Observer >( 7 );
+    nova::non_null_weak_ptr weak( owner );
+    static_assert( std::is_same_v< decltype( weak ), nova::non_null_weak_ptr< Observer > > );
+
+    SECTION( "lock while alive" )
+    {
+        auto locked = weak.lock();
+        static_assert( std::is_same_v< decltype( locked ), nova::optional_non_null< std::shared_ptr< Observer > > > );
+        REQUIRE( locked.has_value() );
+        CHECK( locked->id == 7 );
+        CHECK( locked.get() == owner.get() );
+        CHECK( weak.use_count() == 2 );
+        CHECK_FALSE( weak.expired() );
+
+        nova::non_null_shared_ptr< Observer > strong = *std::move( locked );
+        CHECK( strong == owner );
+    }
+
+    SECTION( "lock after expiry" )
+    {
+        nova::non_null_weak_ptr< Observer > other = nova::make_non_null_shared< Observer >( 8 );
+        CHECK( other.expired() );
+        CHECK_FALSE( other.lock().has_value() );
+    }
+
+    SECTION( "copy, move and conversion keep the owner" )
+    {
+        nova::non_null_weak_ptr< Observer > copy  = weak;
+        nova::non_null_weak_ptr< Observer > moved = std::move( copy );
+        CHECK( copy.lock().has_value() ); // NOLINT(bugprone-use-after-move): move is emulated by copy
+        CHECK( moved.lock().has_value() );
+
+        auto                                derived   = nova::make_non_null_shared< DerivedObserver >();
+        nova::non_null_weak_ptr< Observer > converted = derived;
+        CHECK( converted.lock().get() == derived.get() );
+
+        converted = owner;
+        CHECK( converted.lock().get() == owner.get() );
+
+        swap( converted, moved );
+        CHECK( moved.lock().get() == owner.get() );
+    }
+
+    SECTION( "owner-based comparison interoperates" )
+    {
+        std::weak_ptr< Observer > wp = owner.underlying();
+        CHECK_FALSE( owner.owner_before( weak ) );
+        CHECK_FALSE( weak.owner_before( owner ) );
+        CHECK_FALSE( weak.owner_before( wp ) );
+        CHECK_FALSE( weak.owner_before( owner.underlying() ) );
+
+        nova::owner_less less;
+        CHECK_FALSE( less( weak, owner ) );
+        CHECK_FALSE( less( owner, weak ) );
+        CHECK_FALSE( less( weak, wp ) );
+
+        std::set< nova::non_null_weak_ptr< Observer >, nova::owner_less > observers;
+        observers.insert( weak );
+        CHECK( observers.count( owner ) == 1 );
+        CHECK( observers.count( wp ) == 1 );
+
+#if defined( __cpp_lib_smart_ptr_owner_equality ) && __cpp_lib_smart_ptr_owner_equality >= 202306L
+        CHECK( owner.owner_equal( weak ) );
+        CHECK( weak.owner_equal( owner ) );
+        CHECK( nova::owner_hash {}( weak ) == nova::owner_hash {}( owner ) );
+        CHECK( nova::owner_equal {}( weak, wp ) );
+#endif
+    }
+}
+
+TEST_CASE( "non_null_atomic", "[non_null_atomic]" )
+{
+    int a = 1, b = 2, c = 3;
+
+    nova::non_null_atomic< int* > atom { nova::non_null( &a ) };
+    CHECK( atom.load() == &a );
+    CHECK( *atom.load( std::memory_order_acquire ) == 1 );
+    CHECK( atom.is_lock_free() );
+
+    SECTION( "store and implicit load" )
+    {
+        atom.store( nova::non_null( &b ), std::memory_order_release );
+        nova::non_null< int* > loaded = atom;
+        CHECK( *loaded == 2 );
+
+        atom = nova::non_null( &c );
+        CHECK( *atom.load() == 3 );
+    }
+
+    SECTION( "exchange" )
+    {
+        nova::non_null< int* > previous = atom.exchange( nova::non_null( &b ) );
+        CHECK( previous == &a );
+        CHECK( atom.load() == &b );
+    }
+
+    SECTION( "compare_exchange_strong" )
+    {
+        nova::non_null< int* > expected( &b );
+        CHECK_FALSE( atom.compare_exchange_strong( expected, nova::non_null( &c ) ) );
+        CHECK( expected == &a );
+
+        CHECK( atom.compare_exchange_strong(
+            expected, nova::non_null( &c ), std::memory_order_acq_rel, std::memory_order_acquire ) );
+        CHECK( atom.load() == &c );
+    }
+
+    SECTION( "compare_exchange_weak" )
+    {
+        nova::non_null< int* > expected( &a );
+        while ( !atom.compare_exchange_weak( expected, nova::non_null( &b ) ) )
+            CHECK( expected == &a );
+        CHECK( atom.load() == &b );
+    }
+}
+
+static_assert( sizeof( nova::non_null_atomic< int* > ) == sizeof( int* ) );
+static_assert( nova::non_null_atomic< int* >::is_always_lock_free );
+static_assert( !std::is_copy_constructible_v< nova::non_null_atomic< int* > > );
+static_assert( !std::is_constructible_v< nova::non_null_atomic< int* >, std::nullptr_t > );
+static_assert( !std::is_constructible_v< nova::non_null_atomic< int* >, int* > );
+
+// =============================================================================
+// non_null_tagged_ptr
+// =============================================================================
+
+namespace {
+
+struct alignas( 8 ) TreeNode
+{
+    int                                      value;
+    nova::non_null_tagged_ptr< TreeNode, 3 > parent; // self-referential: TreeNode is incomplete here
+};
+
+enum node_flags : std::uintptr_t
+{
+    dirty = 1,
+    red   = 2,
+    leaf  = 4,
+};
+
+} // namespace
+
+static_assert( sizeof( nova::non_null_tagged_ptr< TreeNode, 3 > ) == sizeof( TreeNode* ) );
+static_assert( std::is_trivially_copyable_v< nova::non_null_tagged_ptr< TreeNode, 3 > > );
+static_assert( nova::non_null_tagged_ptr< TreeNode, 3 >::tag_mask == 7 );
+static_assert( !std::is_constructible_v< nova::non_null_tagged_ptr< TreeNode, 3 >, std::nullptr_t > );
+static_assert( !std::is_constructible_v< nova::non_null_tagged_ptr< TreeNode, 3 >, TreeNode* > );
+static_assert( sizeof( nova::non_null_atomic_tagged_ptr< TreeNode, 3 > ) == sizeof( TreeNode* ) );
+static_assert( nova::non_null_atomic_tagged_ptr< TreeNode, 3 >::is_always_lock_free );
+
+TEST_CASE( "non_null_tagged_ptr", "[non_null_tagged_ptr]" )
+{
+    TreeNode root { 1, nova::non_null_tagged_ptr< TreeNode, 3 >( nova::non_null( &root ) ) };
+    TreeNode child { 2, nova::non_null_tagged_ptr< TreeNode, 3 >( nova::non_null( &root ), red | leaf ) };
+
+    CHECK( root.parent.get() == &root );
+    CHECK( root.parent.tag() == 0 );
+    CHECK( child.parent.get() == &root );
+    CHECK( child.parent->value == 1 );
+    CHECK( ( *child.parent ).value == 1 );
+    CHECK( child.parent.tag() == ( red | leaf ) );
+    CHECK( child.parent.untagged() == nova::non_null( &root ) );
+
+    child.parent.set_tag( dirty );
+    CHECK( child.parent.tag() == dirty );
+    CHECK( child.parent.get() == &root );
+
+    child.parent.set_pointer( nova::non_null( &child ) );
+    CHECK( child.parent.get() == &child );
+    CHECK( child.parent.tag() == dirty );
+
+    auto copy = child.parent;
+    CHECK( copy == child.parent );
+    copy.set_tag( 0 );
+    CHECK_FALSE( copy == child.parent );
+
+    auto round_trip = nova::non_null_tagged_ptr< TreeNode, 3 >::from_bits( child.parent.to_bits() );
+    CHECK( round_trip == child.parent );
+}
+
+TEST_CASE( "non_null_atomic<non_null_tagged_ptr>", "[non_null_tagged_ptr][non_null_atomic]" )
+{
+    using tagged = nova::non_null_tagged_ptr< TreeNode, 3 >;
+
+    TreeNode a { 1, tagged( nova::non_null( &a ) ) };
+    TreeNode b { 2, tagged( nova::non_null( &b ) ) };
+
+    nova::non_null_atomic< tagged > link { tagged( nova::non_null( &a ), red ) };
+    CHECK( link.load().get() == &a );
+    CHECK( link.load().tag() == red );
+
+    SECTION( "store, exchange and compare_exchange" )
+    {
+        link.store( tagged( nova::non_null( &b ) ) );
+        CHECK( link.load().get() == &b );
+
+        tagged previous = link.exchange( tagged( nova::non_null( &a ), leaf ) );
+        CHECK( previous.get() == &b );
+
+        tagged expected { nova::non_null( &a ) }; // tag mismatch: fails and reloads
+        CHECK_FALSE( link.compare_exchange_strong( expected, tagged( nova::non_null( &b ) ) ) );
+        CHECK( expected.tag() == leaf );
+        while ( !link.compare_exchange_weak( expected, tagged( nova::non_null( &b ), dirty ) ) )
+            ;
+        CHECK( link.load() == tagged( nova::non_null( &b ), dirty ) );
+    }
+
+    SECTION( "tag-only updates keep the pointer" )
+    {
+        CHECK( link.fetch_or_tag( dirty ).tag() == red );
+        CHECK( link.load().tag() == ( red | dirty ) );
+        CHECK( link.fetch_and_tag( dirty ).tag() == ( red | dirty ) );
+        CHECK( link.load().tag() == dirty );
+        CHECK( link.exchange_tag( leaf ).tag() == dirty );
+        CHECK( link.load().tag() == leaf );
+        CHECK( link.load().get() == &a );
+    }
+
+    SECTION( "concurrent tag updates" )
+    {
+        link.store( tagged( nova::non_null( &a ) ) );
+        std::thread set_dirty( [ & ] {
+            link.fetch_or_tag( dirty );
+        } );
+        std::thread set_leaf( [ & ] {
+            link.fetch_or_tag( leaf );
+        } );
+        set_dirty.join();
+        set_leaf.join();
+        CHECK( link.load() == tagged( nova::non_null( &a ), dirty | leaf ) );
+    }
+}
+
+TEST_CASE( "non_null_atomic<shared_ptr>", "[non_null_atomic][shared_ptr]" )
+{
+    auto                                            first = nova::make_non_null_shared< int >( 1 );
+    nova::non_null_atomic< std::shared_ptr< int > > atom( first );
+
+    SECTION( "snapshot does not touch the reference count" )
+    {
+        const long count_before = first.use_count();
+        auto       snap         = atom.snapshot();
+        CHECK( *snap == 1 );
+        CHECK( snap.get() == first.get() );
+        CHECK( first.use_count() == count_before );
+        CHECK( snap.value().use_count() == count_before );
+        CHECK_FALSE( snap.value().owner_before( first ) );
+        CHECK_FALSE( first.owner_before( snap.value() ) );
+    }
+
+    SECTION( "snapshot keeps the old value alive across store" )
+    {
+        std::weak_ptr< int > weak = first.underlying();
+        first                     = nova::make_non_null_shared< int >( 0 );
+
+        {
+            auto snap = atom.snapshot();
+            atom.store( nova::make_non_null_shared< int >( 2 ) );
+            CHECK( *snap == 1 );
+            CHECK_FALSE( weak.expired() );
+            CHECK( *atom.snapshot() == 2 );
+        }
+
+        CHECK( weak.expired() ); // the last snapshot released the retired value
+    }
+
+    SECTION( "reclaim keeps values that are still protected" )
+    {
+        std::weak_ptr< int > weak = first.underlying();
+        first                     = nova::make_non_null_shared< int >( 0 );
+
+        {
+            auto snap = atom.snapshot();
+            atom.store( nova::make_non_null_shared< int >( 2 ) );
+            atom.reclaim();
+            CHECK_FALSE( weak.expired() );
+            CHECK( *snap == 1 );
+        }
+
+        CHECK( weak.expired() );
+        atom.reclaim();
+        CHECK( *atom.snapshot() == 2 );
+    }
+
+    SECTION( "more snapshots than hazard slots" )
+    {
+        auto s1 = atom.snapshot();
+        auto s2 = atom.snapshot();
+        auto s3 = atom.snapshot();
+        auto s4 = atom.snapshot();
+        auto s5 = atom.snapshot(); // falls back to a reference-counted copy
+        CHECK( *s1 + *s2 + *s3 + *s4 + *s5 == 5 );
+    }
+
+    SECTION( "load, exchange and compare_exchange" )
+    {
+        nova::non_null_shared_ptr< int > loaded = atom.load();
+        CHECK( loaded == first );
+
+        auto previous = atom.exchange( nova::make_non_null_shared< int >( 2 ) );
+        CHECK( previous == first );
+
+        auto expected = first;
+        CHECK_FALSE( atom.compare_exchange_strong( expected, nova::make_non_null_shared< int >( 3 ) ) );
+        CHECK( *expected == 2 );
+        CHECK( atom.compare_exchange_strong( expected, nova::make_non_null_shared< int >( 4 ) ) );
+        CHECK( *atom.load() == 4 );
+    }
+}
+
+TEST_CASE( "non_null_atomic<shared_ptr> - concurrent readers and writer", "[non_null_atomic][shared_ptr][thread]" )
+{
+    struct Config
+    {
+        int a;
+        int b; // invariant: b == -a
+    };
+
+    nova::non_null_atomic_shared_ptr< Config > config( nova::make_non_null_shared< Config >( 0, 0 ) );
+    std::atomic< bool >                        done { false };
+    std::atomic< int >                         violations { 0 };
+
+    std::vector< std::thread > readers;
+    for ( int i = 0; i != 4; ++i )
+        readers.emplace_back( [ & ] {
+            while ( !done.load( std::memory_order_relaxed ) ) {
+                auto snap = config.snapshot();
+                if ( snap->a != -snap->b )
+                    violations.fetch_add( 1 );
+            }
+        } );
+
+    for ( int i = 1; i != 2000; ++i )
+        config.store( nova::make_non_null_shared< Config >( i, -i ) );
+
+    done = true;
+    for ( auto& t : readers )
+        t.join();
+
+    CHECK( violations.load() == 0 );
+    CHECK( config.snapshot()->a == 1999 );
+}
+
+// =============================================================================
+// non_null_trivial_unique_ptr
+// =============================================================================
+
+static_assert( sizeof( nova::non_null_trivial_unique_ptr< int > ) == sizeof( int* ) );
+static_assert( std::is_nothrow_move_constructible_v< nova::non_null_trivial_unique_ptr< int > > );
+static_assert( !std::is_copy_constructible_v< nova::non_null_trivial_unique_ptr< int > > );
+static_assert( !std::is_constructible_v< nova::non_null_trivial_unique_ptr< int >, std::nullptr_t > );
+static_assert( nova::is_trivially_relocatable_v< nova::non_null_trivial_unique_ptr< int > > );
+
+namespace {
+
+struct CountingDeleter
+{
+    int* deletions;
+
+    void operator()( int* p ) const noexcept
+    {
+        ++*deletions;
+        delete p;
+    }
+};
+
+int consume_stage( nova::non_null_trivial_unique_ptr< int > p )
+{
+    return *p;
+}
+
+nova::non_null_trivial_unique_ptr< int > forward_stage( nova::non_null_trivial_unique_ptr< int > p )
+{
+    *p += 1;
+    return p;
+}
+
+} // namespace
+
+TEST_CASE( "non_null_trivial_unique_ptr", "[non_null_trivial_unique_ptr][unique_ptr]" )
+{
+    SECTION( "construction and access" )
+    {
+        auto p = nova::make_non_null_trivial_unique< int >( 42 );
+        CHECK( *p == 42 );
+        CHECK( p.get() != nullptr );
+        CHECK( static_cast< bool >( p ) );
+        CHECK_FALSE( p == nullptr );
+    }
+
+    SECTION( "from std::unique_ptr and non_null_unique_ptr" )
+    {
+        auto up  = std::make_unique< int >( 1 );
+        int* raw = up.get();
+        nova::non_null_trivial_unique_ptr p( std::move( up ) );
+        CHECK( up == nullptr );
+        CHECK( p.get() == raw );
+
+        auto                                     nn = nova::make_non_null_unique< int >( 2 );
+        nova::non_null_trivial_unique_ptr< int > q( std::move( nn ) );
+        CHECK( *q == 2 );
+    }
+
+    SECTION( "ownership passes through by-value stages" )
+    {
+        auto p = nova::make_non_null_trivial_unique< int >( 1 );
+        auto q = forward_stage( forward_stage( std::move( p ) ) );
+        CHECK( *q == 3 );
+        CHECK( consume_stage( std::move( q ) ) == 3 );
+    }
+
+    SECTION( "take returns the unique_ptr with its deleter" )
+    {
+        int deletions = 0;
+        {
+            nova::non_null_trivial_unique_ptr< int, CountingDeleter > p( new int( 5 ), CountingDeleter { &deletions } );
+            CHECK( p.get_deleter().deletions == &deletions );
+
+            std::unique_ptr< int, CountingDeleter > up = take( std::move( p ) );
+            CHECK( *up == 5 );
+            CHECK( up.get_deleter().deletions == &deletions );
+            CHECK( deletions == 0 );
+        }
+        CHECK( deletions == 1 );
+    }
+
+    SECTION( "move assignment destroys the previous object" )
+    {
+        int deletions = 0;
+        using P       = nova::non_null_trivial_unique_ptr< int, CountingDeleter >;
+        P a( new int( 1 ), CountingDeleter { &deletions } );
+        P b( new int( 2 ), CountingDeleter { &deletions } );
+
+        a = std::move( b );
+        CHECK( deletions == 1 );
+        CHECK( *a == 2 );
+
+        // A taken object can be assigned to again.
+        b = std::move( a );
+        CHECK( deletions == 1 );
+        CHECK( *b == 2 );
+    }
+
+    SECTION( "swap" )
+    {
+        auto a    = nova::make_non_null_trivial_unique< int >( 1 );
+        auto b    = nova::make_non_null_trivial_unique< int >( 2 );
+        int* rawa = a.get();
+        swap( a, b );
+        CHECK( b.get() == rawa );
+        CHECK( *a == 2 );
+        CHECK( a != b );
+    }
+}
+
+// =============================================================================
+// non_null_box
+// =============================================================================
+
+namespace {
+
+struct Shape
+{
+    virtual ~Shape() = default;
+
+    virtual double area() const    = 0;
+    virtual void   scale( double ) = 0;
+};
+
+struct Square : Shape
+{
+    double side;
+
+    explicit Square( double s ) :
+        side( s )
+    {}
+
+    double area() const override
+    {
+        return side * side;
+    }
+
+    void scale( double f ) override
+    {
+        side *= f;
+    }
+};
+
+struct Tracked
+{
+    static inline int alive = 0;
+
+    int value = 0;
+
+    Tracked() noexcept
+    {
+        ++alive;
+    }
+    explicit Tracked( int v ) noexcept :
+        value( v )
+    {
+        ++alive;
+    }
+    Tracked( const Tracked& other ) noexcept :
+        value( other.value )
+    {
+        ++alive;
+    }
+    Tracked( Tracked&& other ) noexcept :
+        value( std::exchange( other.value, -1 ) )
+    {
+        ++alive;
+    }
+    Tracked& operator=( const Tracked& ) = default;
+    ~Tracked()
+    {
+        --alive;
+    }
+};
+
+} // namespace
+
+TEST_CASE( "non_null_box", "[non_null_box]" )
+{
+    SECTION( "value semantics: deep copy" )
+    {
+        nova::non_null_box< std::string > a( "pimpl" );
+        nova::non_null_box< std::string > b = a;
+        CHECK( *b == "pimpl" );
+        CHECK( b.get() != a.get() );
+
+        b->append( "!" );
+        CHECK( *a == "pimpl" );
+        CHECK( a != b );
+
+        a = b;
+        CHECK( a == b );
+        CHECK( a.get() != b.get() );
+    }
+
+    SECTION( "move steals a heap object and leaves the sentinel" )
+    {
+        nova::non_null_box< std::string > a( std::string( 100, 'x' ) );
+        const std::string*                 object = a.get();
+
+        nova::non_null_box< std::string > b = std::move( a );
+        CHECK( b.get() == object );
+        REQUIRE( std::as_const( a ).get() != nullptr );
+        CHECK( std::as_const( a )->empty() );
+        static_assert( std::is_nothrow_move_constructible_v< nova::non_null_box< std::string > > );
+
+        // A moved-from box can be assigned and copied again.
+        nova::non_null_box< std::string > c = a;
+        CHECK( c->empty() );
+        a = std::move( b );
+        CHECK( a.get() == object );
+    }
+
+    SECTION( "writing through a moved-from box gives it its own object" )
+    {
+        nova::non_null_box< std::string > a( std::string( 100, 'a' ) );
+        nova::non_null_box< std::string > b( std::string( 100, 'b' ) );
+        nova::non_null_box< std::string > a2 = std::move( a );
+        nova::non_null_box< std::string > b2 = std::move( b );
+        CHECK( std::as_const( a ).get() == std::as_const( b ).get() ); // the shared sentinel
+
+        *a = "written";
+        a->append( "!" );
+        CHECK( *a == "written!" );
+        CHECK( std::as_const( b )->empty() );
+        CHECK( std::as_const( a ).get() != std::as_const( b ).get() );
+
+        std::string stolen = *std::move( b );
+        CHECK( stolen.empty() );
+        CHECK( *a2 == std::string( 100, 'a' ) );
+    }
+
+    SECTION( "small objects stay inline" )
+    {
+        using box = nova::non_null_box< Tracked, sizeof( Tracked ) >;
+        {
+            box a( std::in_place, 7 );
+            CHECK( a.stored_inline() );
+            CHECK( static_cast< const void* >( a.get() ) >= static_cast< const void* >( &a ) );
+            CHECK( static_cast< const void* >( a.get() ) < static_cast< const void* >( &a + 1 ) );
+
+            box b = std::move( a );
+            CHECK( b->value == 7 );
+            CHECK( a->value == -1 ); // moved-from, but still an object
+
+            box c;
+            c.swap( b );
+            CHECK( c->value == 7 );
+            CHECK( b->value == 0 );
+            CHECK( Tracked::alive == 3 );
+        }
+        CHECK( Tracked::alive == 0 );
+        static_assert( !nova::is_trivially_relocatable_v< box > );
+    }
+
+    SECTION( "polymorphic values" )
+    {
+        nova::non_null_box< Shape > a( std::in_place_type< Square >, 2.0 );
+        nova::non_null_box< Shape > b = a; // copies the Square
+        b->scale( 2.0 );
+        CHECK( a->area() == 4.0 );
+        CHECK( b->area() == 16.0 );
+
+        nova::non_null_box< Shape > c( Square( 3.0 ) );
+        CHECK( c->area() == 9.0 );
+
+        // No sentinel for an abstract T: the move reallocates and the source keeps a Square.
+        nova::non_null_box< Shape > d = std::move( c );
+        CHECK( d->area() == 9.0 );
+        CHECK( dynamic_cast< Square* >( c.get() ) != nullptr );
+        static_assert( !std::is_nothrow_move_constructible_v< nova::non_null_box< Shape > > );
+
+        swap( a, d );
+        CHECK( a->area() == 9.0 );
+        CHECK( d->area() == 4.0 );
+    }
+
+    SECTION( "move-only objects and borrow" )
+    {
+        nova::non_null_box< std::unique_ptr< int > > a( std::make_unique< int >( 5 ) );
+        nova::non_null_box< std::unique_ptr< int > > b = std::move( a );
+        CHECK( **b == 5 );
+        CHECK( *std::as_const( a ) == nullptr );
+
+        nova::non_null< std::unique_ptr< int >* > p = b.borrow();
+        CHECK( **p == 5 );
+        const auto& cb = b;
+        static_assert( std::is_same_v< decltype( cb.borrow() ), nova::non_null< const std::unique_ptr< int >* > > );
+        static_assert( std::is_same_v< decltype( *cb ), const std::unique_ptr< int >& > );
+    }
+
+    CHECK( Tracked::alive == 0 );
+}
+
+static_assert( sizeof( nova::non_null_box< int > ) == 2 * sizeof( void* ) );
+static_assert( nova::is_trivially_relocatable_v< nova::non_null_box< std::string > > );
+static_assert( !std::is_default_constructible_v< nova::non_null_box< Shape > > );
+static_assert( !std::is_constructible_v< nova::non_null_box< int >, std::nullptr_t > );
+static_assert( !std::is_copy_constructible_v< nova::non_null_box< std::unique_ptr< int > > > );
+static_assert( std::is_copy_constructible_v< nova::non_null_box< Shape > > );
+static_assert( !std::is_convertible_v< std::string, nova::non_null_box< std::string > > );
+
+// =============================================================================
+// non_null_intrusive_ptr
+// =============================================================================
+
+namespace {
+
+struct Message : nova::intrusive_ref_counter< Message >
+{
+    static inline int alive = 0;
+
+    explicit Message( int id ) :
+        id( id )
+    {
+        ++alive;
+    }
+    ~Message()
+    {
+        --alive;
+    }
+
+    int id;
+};
+
+struct ShardMessage : nova::intrusive_ref_counter< ShardMessage, nova::intrusive_thread_unsafe_counter >
+{
+    int id = 0;
+};
+
+struct DerivedMessage : Message
+{
+    using Message::Message;
+};
+
+// A type bringing its own customisation points instead of the CRTP base.
+struct CustomCounted
+{
+    int refs = 0;
+};
+
+void intrusive_ptr_add_ref( const CustomCounted* p ) noexcept
+{
+    ++const_cast< CustomCounted* >( p )->refs;
+}
+
+void intrusive_ptr_release( const CustomCounted* p ) noexcept
+{
+    --const_cast< CustomCounted* >( p )->refs;
+}
+
+} // namespace
+
+static_assert( sizeof( nova::non_null_intrusive_ptr< Message > ) == sizeof( void* ) );
+static_assert( sizeof( nova::intrusive_ptr< ShardMessage > ) == sizeof( void* ) );
+static_assert( std::is_nothrow_move_constructible_v< nova::non_null_intrusive_ptr< Message > > );
+static_assert( std::is_copy_constructible_v< nova::non_null_intrusive_ptr< Message > > );
+static_assert( nova::is_trivially_relocatable_v< nova::non_null_intrusive_ptr< Message > > );
+
+TEST_CASE( "non_null_intrusive_ptr", "[non_null_intrusive_ptr]" )
+{
+    SECTION( "make_non_null_intrusive and refcounting" )
+    {
+        {
+            auto p = nova::make_non_null_intrusive< Message >( 7 );
+            CHECK( p->id == 7 );
+            CHECK( p->use_count() == 1 );
+            CHECK( Message::alive == 1 );
+
+            auto q = p;
+            CHECK( p->use_count() == 2 );
+            CHECK( p == q );
+
+            auto r = nova::make_non_null_intrusive< Message >( 8 );
+            CHECK( p != r );
+            CHECK( ( p < r ) == ( p.get() < r.get() ) );
+        }
+        CHECK( Message::alive == 0 );
+    }
+
+    SECTION( "take releases the reference into an intrusive_ptr" )
+    {
+        auto                           p   = nova::make_non_null_intrusive< Message >( 1 );
+        Message*                       raw = p.get();
+        nova::intrusive_ptr< Message > ip  = take( std::move( p ) );
+        CHECK( ip.get() == raw );
+        CHECK( ip->use_count() == 1 );
+
+        nova::non_null q( std::move( ip ) );
+        CHECK( q.get() == raw );
+        CHECK( q->use_count() == 1 );
+    }
+
+    SECTION( "derived to base conversion" )
+    {
+        nova::non_null_intrusive_ptr< DerivedMessage > d = nova::make_non_null_intrusive< DerivedMessage >( 3 );
+        nova::non_null_intrusive_ptr< Message >        b = d;
+        CHECK( b->id == 3 );
+        CHECK( b->use_count() == 2 );
+    }
+
+    SECTION( "thread-unsafe counter" )
+    {
+        auto p = nova::make_non_null_intrusive< ShardMessage >();
+        {
+            auto q = p;
+            CHECK( q->use_count() == 2 );
+        }
+        CHECK( p->use_count() == 1 );
+    }
+
+    SECTION( "custom customisation points" )
+    {
+        CustomCounted obj;
+        {
+            nova::non_null p { nova::intrusive_ptr< CustomCounted >( &obj ) };
+            auto           q = p;
+            CHECK( obj.refs == 2 );
+        }
+        CHECK( obj.refs == 0 );
+    }
+
+    SECTION( "optional_non_null and hashing" )
+    {
+        nova::optional_non_null< nova::intrusive_ptr< Message > > opt;
+        CHECK_FALSE( opt );
+        opt = nova::optional_non_null< nova::intrusive_ptr< Message > >(
+            nova::make_non_null_intrusive< Message >( 2 ) );
+        REQUIRE( opt );
+        CHECK( ( *opt )->id == 2 );
+
+        std::unordered_set< nova::non_null_intrusive_ptr< Message >, nova::pointer_hash, nova::pointer_equal > set;
+        auto p = nova::make_non_null_intrusive< Message >( 4 );
+        set.insert( p );
+        CHECK( set.count( p ) == 1 );
+    }
+
+    CHECK( Message::alive == 0 );
+}
+
+// =============================================================================
+// borrow()
+// =============================================================================
+
+namespace {
+
+int read_borrowed( nova::non_null_borrow< const int > p )
+{
+    return *p;
+}
+
+template < typename T >
+concept borrowable_from_rvalue = requires( T&& t ) { std::forward< T >( t ).borrow(); };
+
+} // namespace
+
+TEST_CASE( "borrow() yields non_null<T*> without reference counting", "[borrow]" )
+{
+    SECTION( "shared_ptr" )
+    {
+        const auto sp = nova::make_non_null_shared< int >( 1 );
+        auto       p  = sp.borrow();
+        static_assert( std::is_same_v< decltype( p ), nova::non_null< int* > > );
+        CHECK( p.get() == sp.get() );
+        CHECK( sp.use_count() == 1 );
+        CHECK( read_borrowed( sp.borrow() ) == 1 );
+    }
+
+    SECTION( "unique_ptr and arrays" )
+    {
+        auto up = nova::make_non_null_unique< int >( 2 );
+        CHECK( read_borrowed( up.borrow() ) == 2 );
+
+        nova::non_null< std::unique_ptr< int[] > > arr( std::make_unique< int[] >( 3 ) );
+        static_assert( std::is_same_v< decltype( arr.borrow() ), nova::non_null< int* > > );
+        CHECK( arr.borrow().get() == arr.get() );
+    }
+
+    SECTION( "intrusive_ptr" )
+    {
+        auto                             msg = nova::make_non_null_intrusive< Message >( 3 );
+        nova::non_null_borrow< Message > p   = msg.borrow();
+        CHECK( p->id == 3 );
+        CHECK( msg->use_count() == 1 );
+    }
+
+    SECTION( "raw pointer, trivial unique_ptr, tagged pointer and snapshot" )
+    {
+        int                    value = 4;
+        nova::non_null< int* > raw( &value );
+        CHECK( raw.borrow() == raw );
+        CHECK( nova::non_null< int* >( &value ).borrow().get() == &value );
+
+        auto trivial = nova::make_non_null_trivial_unique< int >( 5 );
+        CHECK( read_borrowed( trivial.borrow() ) == 5 );
+
+        nova::non_null_atomic< std::shared_ptr< int > > holder( nova::make_non_null_shared< int >( 6 ) );
+        auto                                            snap = holder.snapshot();
+        CHECK( read_borrowed( snap.borrow() ) == 6 );
+
+        struct alignas( 4 ) Aligned
+        {
+            int v = 7;
+        } aligned;
+        nova::non_null_tagged_ptr< Aligned, 2 > tagged( nova::non_null< Aligned* >( &aligned ), 3 );
+        CHECK( tagged.borrow()->v == 7 );
+    }
+
+    SECTION( "contract policy is kept" )
+    {
+        nova::non_null< std::shared_ptr< int >, nova::contract_throw > sp( std::make_shared< int >( 8 ) );
+        static_assert( std::is_same_v< decltype( sp.borrow() ), nova::non_null< int*, nova::contract_throw > > );
+        CHECK( read_borrowed( sp.borrow() ) == 8 );
+    }
+}
+
+// Borrowing from a temporary owner would dangle
+static_assert( !borrowable_from_rvalue< nova::non_null_shared_ptr< int > > );
+static_assert( !borrowable_from_rvalue< nova::non_null_unique_ptr< int > > );
+static_assert( !borrowable_from_rvalue< nova::non_null_trivial_unique_ptr< int > > );
+static_assert( !borrowable_from_rvalue< nova::non_null_atomic< std::shared_ptr< int > >::snapshot_type > );
+static_assert( borrowable_from_rvalue< nova::non_null< int* > > );
+static_assert( borrowable_from_rvalue< nova::non_null_borrow< int > > );
+
+// =============================================================================
+// allocator-aware factories
+// =============================================================================
+
+namespace {
+
+struct AllocStats
+{
+    int allocations   = 0;
+    int deallocations = 0;
+};
+
+template < typename T >
+struct CountingAllocator
+{
+    using value_type = T;
+
+    AllocStats* stats;
+
+    explicit CountingAllocator( AllocStats* s ) noexcept :
+        stats( s )
+    {}
+
+    template < typename U >
+    CountingAllocator( const CountingAllocator< U >& other ) noexcept :
+        stats( other.stats )
+    {}
+
+    T* allocate( std::size_t n )
+    {
+        ++stats->allocations;
+        return std::allocator< T > {}.allocate( n );
+    }
+
+    void deallocate( T* p, std::size_t n ) noexcept
+    {
+        ++stats->deallocations;
+        std::allocator< T > {}.deallocate( p, n );
+    }
+
+    template < typename U >
+    bool operator==( const CountingAllocator< U >& other ) const noexcept
+    {
+        return stats == other.stats;
+    }
+};
+
+struct Pair
+{
+    int a = 1;
+    int b = 2;
+};
+
+} // namespace
+
+TEST_CASE( "allocate_non_null_unique", "[factory][allocator]" )
+{
+    AllocStats                stats;
+    CountingAllocator< char > alloc( &stats );
+
+    SECTION( "single object" )
+    {
+        {
+            auto p = nova::allocate_non_null_unique< Pair >( alloc );
+            CHECK( p->a == 1 );
+            CHECK( stats.allocations == 1 );
+            CHECK( p.get_deleter().get_allocator().stats == &stats );
+
+            using expected = nova::non_null_allocated_unique_ptr< Pair, CountingAllocator< char > >;
+            static_assert( std::is_same_v< decltype( p ), expected > );
+        }
+        CHECK( stats.deallocations == 1 );
+    }
+
+    SECTION( "arguments are forwarded" )
+    {
+        auto p = nova::allocate_non_null_unique< std::string >( alloc, 3u, 'x' );
+        CHECK( *p == "xxx" );
+    }
+
+    SECTION( "array" )
+    {
+        {
+            auto p = nova::allocate_non_null_unique< int[] >( alloc, 16 );
+            CHECK( p.get_deleter().size() == 16 );
+            for ( std::size_t i = 0; i != 16; ++i )
+                CHECK( p[ i ] == 0 );
+            p[ 3 ] = 7;
+            CHECK( p.get()[ 3 ] == 7 );
+        }
+        CHECK( stats.allocations == 1 );
+        CHECK( stats.deallocations == 1 );
+    }
+
+    SECTION( "for_overwrite" )
+    {
+        auto p = nova::allocate_non_null_unique_for_overwrite< Pair >( alloc );
+        CHECK( p->b == 2 ); // non-trivial default constructor still runs
+
+        auto buf = nova::allocate_non_null_unique_for_overwrite< unsigned char[] >( alloc, 4096 );
+        CHECK( buf.get_deleter().size() == 4096 );
+        CHECK( stats.allocations == 2 );
+    }
+
+    SECTION( "take keeps the allocator-aware deleter" )
+    {
+        auto p  = nova::allocate_non_null_unique< Pair >( alloc );
+        auto up = take( std::move( p ) );
+        CHECK( up.get_deleter().get_allocator().stats == &stats );
+        up.reset();
+        CHECK( stats.deallocations == 1 );
+    }
+}
+
+TEST_CASE( "allocate_non_null_shared", "[factory][allocator]" )
+{
+    AllocStats                stats;
+    CountingAllocator< char > alloc( &stats );
+
+    {
+        auto p = nova::allocate_non_null_shared< Pair >( alloc );
+        CHECK( p->a == 1 );
+        CHECK( p.use_count() == 1 );
+
+        auto arr = nova::allocate_non_null_shared< int[] >( alloc, 8 );
+        CHECK( arr[ 7 ] == 0 );
+
+#if defined( __cpp_lib_smart_ptr_for_overwrite ) && __cpp_lib_smart_ptr_for_overwrite >= 202002L
+        auto buf = nova::allocate_non_null_shared_for_overwrite< unsigned char[] >( alloc, 1024 );
+        buf[ 0 ] = 1;
+        CHECK( buf[ 0 ] == 1 );
+#endif
+        CHECK( stats.allocations >= 2 );
+    }
+    CHECK( stats.allocations == stats.deallocations );
+}
+
+TEST_CASE( "allocate_non_null_* from a std::pmr::memory_resource", "[factory][allocator][pmr]" )
+{
+    unsigned char                       buffer[ 4096 ];
+    std::pmr::monotonic_buffer_resource arena( buffer, sizeof( buffer ), std::pmr::null_memory_resource() );
+
+    auto in_arena = [ & ]( const void* p ) {
+        auto* b = static_cast< const unsigned char* >( p );
+        return b >= buffer && b < buffer + sizeof( buffer );
+    };
+
+    auto u = nova::allocate_non_null_unique< Pair >( &arena );
+    static_assert( std::is_same_v< decltype( u ), nova::non_null_pmr_unique_ptr< Pair > > );
+    CHECK( in_arena( u.get() ) );
+    CHECK( u.get_deleter().get_allocator().resource() == &arena );
+
+    auto arr = nova::allocate_non_null_unique_for_overwrite< int[] >( &arena, 64 );
+    CHECK( in_arena( arr.get() ) );
+
+    auto s = nova::allocate_non_null_shared< Pair >( &arena );
+    CHECK( in_arena( s.get() ) );
+    CHECK( s->b == 2 );
+}
+
+// =============================================================================
+// contract policies
+// =============================================================================
+
+static_assert( nova::contract_policy< nova::contract_trust > );
+static_assert( nova::contract_policy< nova::contract_trap > );
+static_assert( std::is_same_v< nova::non_null< int* >::contract_type, nova::contract_default > );
+static_assert( sizeof( nova::non_null< int*, nova::contract_trap > ) == sizeof( int* ) );
+static_assert( !std::is_same_v< nova::non_null< int*, nova::contract_trap >, nova::non_null< int* > > );
+
+namespace {
+
+int                  handler_calls = 0;
+std::source_location handler_where;
+
+void throwing_handler( const nova::contract_violation& v )
+{
+    ++handler_calls;
+    handler_where = v.where;
+    throw std::runtime_error( v.what );
+}
+
+} // namespace
+
+TEST_CASE( "contract policies", "[contract]" )
+{
+    int  value = 1;
+    int* null  = nullptr;
+
+    SECTION( "non-null values pass every policy" )
+    {
+        nova::non_null< int*, nova::contract_trust >   a( &value );
+        nova::non_null< int*, nova::contract_assert >  b( &value );
+        nova::non_null< int*, nova::contract_trap >    c( &value );
+        nova::non_null< int*, nova::contract_handler > d( &value );
+        nova::non_null< int*, nova::contract_throw >   e( &value );
+        CHECK( a == b );
+        CHECK( c == d );
+        CHECK( *e == 1 );
+    }
+
+    SECTION( "contract_throw" )
+    {
+        using checked = nova::non_null< int*, nova::contract_throw >;
+        CHECK_THROWS_AS( checked( null ), nova::contract_violation_error );
+
+        const unsigned line = std::source_location::current().line() + 2;
+        try {
+            checked p( null );
+            FAIL( "expected contract_violation_error" );
+        } catch ( const nova::contract_violation_error& e ) {
+            CHECK( e.where().line() == line );
+            CHECK( std::string( e.what() ) == "nova::non_null: pointer cannot be null" );
+        }
+
+        using checked_unique = nova::non_null< std::unique_ptr< int >, nova::contract_throw >;
+        CHECK_THROWS_AS( checked_unique( std::unique_ptr< int >() ), nova::contract_violation_error );
+    }
+
+    SECTION( "contract_handler" )
+    {
+        auto previous = nova::set_contract_violation_handler( &throwing_handler );
+        CHECK( nova::get_contract_violation_handler() == &throwing_handler );
+
+        handler_calls = 0;
+        using handled = nova::non_null< int*, nova::contract_handler >;
+        CHECK_THROWS_AS( handled( null ), std::runtime_error );
+        CHECK( handler_calls == 1 );
+        CHECK( std::string_view( handler_where.file_name() ).ends_with( "test_non_null.cpp" ) );
+
+        nova::set_contract_violation_handler( previous );
+    }
+
+    SECTION( "policies convert into each other" )
+    {
+        nova::non_null< int*, nova::contract_trap >        trapped( &value );
+        nova::non_null< int* >                             plain   = trapped;
+        nova::non_null< const int*, nova::contract_trust > trusted = plain;
+        CHECK( trusted.get() == &value );
+
+        nova::optional_non_null< int* > opt = trapped;
+        CHECK( opt.get() == &value );
+
+        std::unordered_set< nova::non_null< int*, nova::contract_trap > > set;
+        set.insert( trapped );
+        CHECK( set.count( trapped ) == 1 );
+    }
+
+    SECTION( "try_make_non_null selects the policy" )
+    {
+        auto opt = nova::try_make_non_null< nova::contract_trap >( &value );
+        using expected = std::optional< nova::non_null< int*, nova::contract_trap > >;
+        static_assert( std::is_same_v< decltype( opt ), expected > );
+        REQUIRE( opt.has_value() );
+        CHECK( opt->get() == &value );
+        CHECK_FALSE( nova::try_make_non_null< nova::contract_throw >( null ).has_value() );
+
+        static_assert( std::is_same_v< decltype( nova::try_make_non_null( &value ) ),
+                                       std::optional< nova::non_null< int* > > > );
+    }
+}
+
+// =============================================================================
+// compile-time non_null for static objects
+// =============================================================================
+
+namespace {
+
+struct Registry
+{
+    int value = 42;
+};
+
+Registry        global_registry;
+constexpr int   constant_value = 7;
+constexpr int*  null_int       = nullptr;
+
+constinit nova::non_null< Registry* > registry_ref = nova::make_static_non_null( &global_registry );
+
+int add_one( int x )
+{
+    return x + 1;
+}
+
+template < auto* Ptr >
+concept can_form_non_null_of = requires { typename nova::non_null_of< Ptr >; };
+
+struct HoldsHandle
+{
+    [[no_unique_address]] nova::non_null_of< &global_registry > registry;
+    int                                                         other;
+};
+
+} // namespace
+
+static_assert( nova::non_null_of< &global_registry >::get() == &global_registry );
+static_assert( *nova::non_null_of< &constant_value > {} == 7 );
+static_assert( std::is_empty_v< nova::non_null_of< &global_registry > > );
+static_assert( sizeof( HoldsHandle ) == sizeof( int ) );
+static_assert( std::is_trivially_copyable_v< nova::non_null_of< &global_registry > > );
+static_assert( !can_form_non_null_of< null_int > );
+static_assert( can_form_non_null_of< &global_registry > );
+static_assert( nova::make_static_non_null( &constant_value ).get() == &constant_value );
+
+TEST_CASE( "make_static_non_null", "[non_null][static]" )
+{
+    CHECK( registry_ref.get() == &global_registry );
+    CHECK( registry_ref->value == 42 );
+
+    auto trapped = nova::make_static_non_null< nova::contract_trap >( &global_registry );
+    static_assert( std::is_same_v< decltype( trapped ), nova::non_null< Registry*, nova::contract_trap > > );
+    CHECK( trapped == registry_ref );
+}
+
+TEST_CASE( "non_null_of", "[non_null][static]" )
+{
+    nova::non_null_of< &global_registry > handle;
+    CHECK( handle->value == 42 );
+    CHECK( ( *handle ).value == 42 );
+    CHECK( static_cast< bool >( handle ) );
+
+    nova::non_null< Registry* >       p  = handle;
+    nova::non_null< const Registry* > cp = handle;
+    CHECK( p.get() == &global_registry );
+    CHECK( cp.get() == &global_registry );
+    CHECK( handle == p );
+    CHECK( handle == nova::non_null_of< &global_registry > {} );
+
+    nova::non_null_of< &add_one > fn;
+    CHECK( ( *fn )( 1 ) == 2 );
+    CHECK( fn.get()( 2 ) == 3 );
+
+    HoldsHandle holder { {}, 1 };
+    CHECK( holder.registry->value == 42 );
+}
+
+// =============================================================================
+// bulk validation
+// =============================================================================
+
+namespace {
+
+constexpr std::size_t constant_first_null()
+{
+    int  a = 0, b = 0;
+    int* ptrs[] = { &a, &b, nullptr, &a };
+    return nova::find_first_null( ptrs, 4 );
+}
+
+} // namespace
+
+static_assert( constant_first_null() == 2 );
+
+TEST_CASE( "find_first_null", "[non_null][bulk]" )
+{
+    std::vector< int >  values( 64 );
+    std::vector< int* > ptrs;
+    for ( int& v : values )
+        ptrs.push_back( &v );
+
+    CHECK( nova::find_first_null( ptrs ) == ptrs.size() );
+    CHECK( nova::find_first_null( ptrs.data(), 0 ) == 0 );
+
+    // every length, every null position (alone and followed by a second
+    // null), and unaligned starts
+    for ( std::size_t offset = 0; offset != 3; ++offset ) {
+        for ( std::size_t count = 0; count + offset <= ptrs.size(); ++count ) {
+            std::span< int* > window( ptrs.data() + offset, count );
+            REQUIRE( nova::find_first_null( window ) == count );
+            for ( std::size_t null_at = 0; null_at != count; ++null_at ) {
+                window[ null_at ] = nullptr;
+                REQUIRE( nova::find_first_null( window ) == null_at );
+                window[ count - 1 ] = nullptr;
+                REQUIRE( nova::find_first_null( window ) == null_at );
+
+                window[ null_at ]   = &values[ offset + null_at ];
+                window[ count - 1 ] = &values[ offset + count - 1 ];
+            }
+        }
+    }
+}
+
+TEST_CASE( "try_make_non_null_range", "[non_null][bulk]" )
+{
+    int                 a = 1, b = 2, c = 3;
+    std::vector< int* > ptrs { &a, &b, &c, &a, &b, &c, &a, &b, &c, &a };
+
+    auto view = nova::try_make_non_null_range( ptrs );
+    static_assert( std::is_same_v< decltype( view ), std::optional< nova::non_null_range< int > > > );
+    static_assert( std::ranges::random_access_range< nova::non_null_range< int > > );
+    static_assert( std::ranges::borrowed_range< nova::non_null_range< int > > );
+    static_assert( std::is_same_v< std::ranges::range_reference_t< nova::non_null_range< int > >,
+                                   nova::non_null< int* > > );
+    REQUIRE( view.has_value() );
+    CHECK( view->data() == ptrs.data() );
+    CHECK( view->size() == ptrs.size() );
+    CHECK( ( *view )[ 1 ].get() == &b );
+    CHECK( ( view->end() - view->begin() ) == 10 );
+
+    int sum = 0;
+    for ( nova::non_null< int* > p : *view )
+        sum += *p;
+    CHECK( sum == 19 );
+
+    int* raw[] = { &a, nullptr, &c };
+    CHECK_FALSE( nova::try_make_non_null_range( raw ).has_value() );
+    CHECK( nova::find_first_null( raw ) == 1 );
+
+    auto trapped = nova::try_make_non_null_range< nova::contract_trap >( ptrs.data(), 3 );
+    using trapped_range = nova::non_null_range< int, nova::contract_trap >;
+    static_assert( std::is_same_v< decltype( trapped ), std::optional< trapped_range > > );
+    static_assert( std::is_same_v< decltype( ( *trapped )[ 0 ] ), nova::non_null< int*, nova::contract_trap > > );
+    REQUIRE( trapped.has_value() );
+    CHECK( ( *trapped )[ 2 ].get() == &c );
+
+    const int* const_ptrs[] = { &a, &b };
+    auto             const_view = nova::try_make_non_null_range( const_ptrs );
+    REQUIRE( const_view.has_value() );
+    CHECK( *( *const_view )[ 1 ] == 2 );
+}
+
+// =============================================================================
+// fancy pointers
+// =============================================================================
+
+namespace {
+
+// A self-relative pointer, like boost::interprocess::offset_ptr: stores the
+// distance from its own address, so it stays valid when the segment holding
+// it is mapped at a different address. No get(): decoded via std::to_address.
+template < typename T >
+class offset_ptr
+{
+public:
+    using element_type    = T;
+    using difference_type = std::ptrdiff_t;
+
+    offset_ptr() noexcept = default;
+    offset_ptr( std::nullptr_t ) noexcept
+    {}
+    offset_ptr( T* p ) noexcept
+    {
+        assign( p );
+    }
+    offset_ptr( const offset_ptr& other ) noexcept
+    {
+        assign( other.address() );
+    }
+    offset_ptr& operator=( const offset_ptr& other ) noexcept
+    {
+        assign( other.address() );
+        return *this;
+    }
+
+    static offset_ptr pointer_to( T& r ) noexcept
+    {
+        return offset_ptr( &r );
+    }
+
+    T* operator->() const noexcept
+    {
+        return address();
+    }
+    T& operator*() const noexcept
+    {
+        return *address();
+    }
+    explicit operator bool() const noexcept
+    {
+        return offset_ != null_offset;
+    }
+    friend bool operator==( const offset_ptr& p, std::nullptr_t ) noexcept
+    {
+        return p.offset_ == null_offset;
+    }
+    friend bool operator==( const offset_ptr& lhs, const offset_ptr& rhs ) noexcept
+    {
+        return lhs.address() == rhs.address();
+    }
+
+    std::ptrdiff_t offset() const noexcept
+    {
+        return offset_;
+    }
+
+private:
+    static constexpr std::ptrdiff_t null_offset = 1; // never a valid distance to a T
+
+    T* address() const noexcept
+    {
+        if ( offset_ == null_offset )
+            return nullptr;
+        return reinterpret_cast< T* >( reinterpret_cast< std::uintptr_t >( this ) + offset_ );
+    }
+
+    void assign( T* p ) noexcept
+    {
+        offset_ = p ? static_cast< std::ptrdiff_t >( reinterpret_cast< std::uintptr_t >( p )
+                                                     - reinterpret_cast< std::uintptr_t >( this ) )
+                    : null_offset;
+    }
+
+    std::ptrdiff_t offset_ = null_offset;
+};
+
+struct Segment
+{
+    int                                          payload[ 4 ] = { 1, 2, 3, 4 };
+    nova::non_null< offset_ptr< int > >          head { offset_ptr< int >( &payload[ 2 ] ) };
+    nova::optional_non_null< offset_ptr< int > > tail;
+};
+
+// Managed pointer type without an element_type member: std::pointer_traits
+// deduces it from the first template argument.
+template < typename T >
+struct bare_ptr
+{
+    T* p = nullptr;
+
+    static bare_ptr pointer_to( T& r ) noexcept
+    {
+        return bare_ptr { &r };
+    }
+    T* operator->() const noexcept
+    {
+        return p;
+    }
+    explicit operator bool() const noexcept
+    {
+        return p != nullptr;
+    }
+    friend bool operator==( const bare_ptr& lhs, std::nullptr_t ) noexcept
+    {
+        return lhs.p == nullptr;
+    }
+};
+
+} // namespace
+
+static_assert( nova::detail::fancy_pointer< offset_ptr< int > > );
+static_assert( nova::detail::fancy_pointer< bare_ptr< int > > );
+static_assert( !nova::detail::fancy_pointer< int* > );
+static_assert( !nova::detail::fancy_pointer< std::shared_ptr< int > > );
+static_assert( std::is_same_v< nova::non_null< bare_ptr< int > >::element_type, int > );
+static_assert( !nova::is_trivially_relocatable_v< nova::non_null< offset_ptr< int > > > );
+
+TEST_CASE( "non_null with fancy pointers", "[non_null][fancy_pointer]" )
+{
+    int  value = 5;
+    auto nn    = nova::non_null( offset_ptr< int >( &value ) );
+    static_assert( std::is_same_v< decltype( nn ), nova::non_null< offset_ptr< int > > > );
+    static_assert( std::is_same_v< decltype( nn.get() ), int* > );
+    CHECK( nn.get() == &value );
+    CHECK( *nn == 5 );
+
+    SECTION( "relocation-independent storage" )
+    {
+        Segment a;
+        CHECK( *a.head == 3 );
+        CHECK( a.head.get() == &a.payload[ 2 ] );
+
+        // a byte-wise copy of the segment (as seen through a second mapping)
+        // decodes to the copy's own payload
+        alignas( Segment ) unsigned char mapping[ sizeof( Segment ) ];
+        std::memcpy( mapping, &a, sizeof( Segment ) );
+        const auto* b = std::launder( reinterpret_cast< const Segment* >( mapping ) );
+        CHECK( b->head.get() == &b->payload[ 2 ] );
+        CHECK( *b->head == 3 );
+    }
+
+    SECTION( "optional_non_null" )
+    {
+        Segment s;
+        CHECK_FALSE( s.tail.has_value() );
+        CHECK( s.tail.get() == nullptr );
+
+        auto opt = nova::optional_non_null( offset_ptr< int >( &value ) );
+        static_assert( std::is_same_v< decltype( opt ), nova::optional_non_null< offset_ptr< int > > > );
+        REQUIRE( opt.has_value() );
+        CHECK( opt.get() == &value );
+        CHECK( ( *opt ).get() == &value );
+    }
+
+    SECTION( "contract check and hashing" )
+    {
+        using checked = nova::non_null< offset_ptr< int >, nova::contract_throw >;
+        CHECK_THROWS_AS( checked( offset_ptr< int >() ), nova::contract_violation_error );
+
+        CHECK( nova::pointer_hash {}( nn ) == nova::pointer_hash {}( &value ) );
+        CHECK( nova::pointer_equal {}( offset_ptr< int >( &value ), &value ) );
+        int* null_raw = nullptr;
+        CHECK( nova::pointer_hash {}( offset_ptr< int >() ) == nova::pointer_hash {}( null_raw ) );
+    }
+
+    SECTION( "pointer_traits without element_type" )
+    {
+        nova::non_null< bare_ptr< int > > bare( bare_ptr< int > { &value } );
+        CHECK( bare.get() == &value );
+        CHECK( *bare.operator->() == 5 );
+    }
+}
@@ -0,0 +1,645 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2026 Tim Blechmann
+
+#include <array>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <unordered_set>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <nova/non_null.hpp>
+
+namespace {
+
+struct Tracked
+{
+    static inline int alive = 0;
+
+    explicit Tracked( int v ) :
+        value( v )
+    {
+        ++alive;
+    }
+    Tracked( const Tracked& )            = delete;
+    Tracked& operator=( const Tracked& ) = delete;
+    ~Tracked()
+    {
+        --alive;
+    }
+
+    int value;
+};
+
+struct DestroyingDeleter
+{
+    std::string tag = "deleter"; // not trivially relocatable by default
+
+    void operator()( Tracked* p ) const noexcept
+    {
+        delete p;
+    }
+};
+
+} // namespace
+
+// =============================================================================
+// is_trivially_relocatable
+// =============================================================================
+
+static_assert( nova::is_trivially_relocatable_v< int* > );
+static_assert( nova::is_trivially_relocatable_v< std::unique_ptr< int > > );
+static_assert( nova::is_trivially_relocatable_v< std::shared_ptr< int > > );
+static_assert( nova::is_trivially_relocatable_v< nova::non_null_unique_ptr< int > > );
+static_assert( nova::is_trivially_relocatable_v< nova::non_null_shared_ptr< int > > );
+static_assert( nova::is_trivially_relocatable_v< nova::optional_non_null< std::unique_ptr< int > > > );
+static_assert( !nova::is_trivially_relocatable_v< std::string > );
+static_assert( !nova::is_trivially_relocatable_v< std::unique_ptr< Tracked, DestroyingDeleter > > );
+
+// std::vector cannot hold move-only non_null wrappers; non_null_vector can.
+static_assert( !std::is_move_constructible_v< nova::non_null_unique_ptr< int > > );
+static_assert( std::is_nothrow_move_constructible_v< nova::non_null_vector< std::unique_ptr< int > > > );
+static_assert( !std::is_copy_constructible_v< nova::non_null_vector< std::unique_ptr< int > > > );
+static_assert( std::is_copy_constructible_v< nova::non_null_vector< std::shared_ptr< int > > > );
+static_assert( sizeof( nova::non_null_vector< int* > ) == 3 * sizeof( void* ) );
+
+TEST_CASE( "relocate_at", "[non_null_vector]" )
+{
+    SECTION( "trivially relocatable" )
+    {
+        alignas( nova::non_null_unique_ptr< int > ) unsigned char src_buf[ sizeof( nova::non_null_unique_ptr< int > ) ];
+        alignas( nova::non_null_unique_ptr< int > ) unsigned char dst_buf[ sizeof( nova::non_null_unique_ptr< int > ) ];
+
+        auto* src = ::new ( src_buf ) nova::non_null_unique_ptr< int >( std::make_unique< int >( 42 ) );
+        int*  raw = src->get();
+        auto* dst = nova::relocate_at( src, reinterpret_cast< nova::non_null_unique_ptr< int >* >( dst_buf ) );
+        CHECK( dst->get() == raw );
+        CHECK( **dst == 42 );
+        dst->~non_null();
+    }
+
+    SECTION( "through take()" )
+    {
+        using P = nova::non_null< std::unique_ptr< Tracked, DestroyingDeleter > >;
+        static_assert( !nova::is_trivially_relocatable_v< P > );
+
+        alignas( P ) unsigned char src_buf[ sizeof( P ) ];
+        alignas( P ) unsigned char dst_buf[ sizeof( P ) ];
+
+        auto*    src = ::new ( src_buf ) P( std::unique_ptr< Tracked, DestroyingDeleter >( new Tracked( 7 ) ) );
+        Tracked* raw = src->get();
+        auto*    dst = nova::relocate_at( src, reinterpret_cast< P* >( dst_buf ) );
+        CHECK( dst->get() == raw );
+        CHECK( Tracked::alive == 1 );
+        dst->~P();
+        CHECK( Tracked::alive == 0 );
+    }
+}
+
+// =============================================================================
+// non_null_vector
+// =============================================================================
+
+TEST_CASE( "non_null_vector of unique_ptr", "[non_null_vector]" )
+{
+    nova::non_null_vector< std::unique_ptr< Tracked > > v;
+    CHECK( v.empty() );
+    CHECK( v.size() == 0 );
+
+    SECTION( "emplace_back grows and keeps pointers stable" )
+    {
+        std::vector< Tracked* > raws;
+        for ( int i = 0; i != 100; ++i ) {
+            v.emplace_back( std::make_unique< Tracked >( i ) );
+            raws.push_back( v.back().get() );
+        }
+        REQUIRE( v.size() == 100 );
+        CHECK( v.capacity() >= 100 );
+        CHECK( Tracked::alive == 100 );
+        for ( int i = 0; i != 100; ++i ) {
+            CHECK( v[ i ].get() == raws[ i ] );
+            CHECK( v[ i ]->value == i );
+        }
+    }
+
+    SECTION( "push_back takes from a non_null" )
+    {
+        nova::non_null_unique_ptr< Tracked > p( std::make_unique< Tracked >( 3 ) );
+        Tracked*                             raw = p.get();
+        v.push_back( std::move( p ) );
+        REQUIRE( v.size() == 1 );
+        CHECK( v.front().get() == raw );
+    }
+
+    SECTION( "take_back and pop_back" )
+    {
+        v.emplace_back( std::make_unique< Tracked >( 1 ) );
+        v.emplace_back( std::make_unique< Tracked >( 2 ) );
+
+        std::unique_ptr< Tracked > up = v.take_back();
+        CHECK( up->value == 2 );
+        CHECK( v.size() == 1 );
+        CHECK( Tracked::alive == 2 );
+
+        v.pop_back();
+        CHECK( v.empty() );
+        CHECK( Tracked::alive == 1 );
+    }
+
+    SECTION( "erase relocates the tail" )
+    {
+        for ( int i = 0; i != 5; ++i )
+            v.emplace_back( std::make_unique< Tracked >( i ) );
+
+        auto it = v.erase( v.begin() + 1 );
+        CHECK( it->get()->value == 2 );
+        REQUIRE( v.size() == 4 );
+        CHECK( Tracked::alive == 4 );
+        CHECK( v[ 0 ]->value == 0 );
+        CHECK( v[ 1 ]->value == 2 );
+        CHECK( v[ 3 ]->value == 4 );
+
+        v.erase( v.end() - 1 );
+        CHECK( v.size() == 3 );
+        CHECK( v.back()->value == 3 );
+    }
+
+    SECTION( "move leaves an empty vector" )
+    {
+        v.emplace_back( std::make_unique< Tracked >( 1 ) );
+        nova::non_null_vector< std::unique_ptr< Tracked > > w( std::move( v ) );
+        CHECK( w.size() == 1 );
+        CHECK( v.empty() ); // NOLINT(bugprone-use-after-move)
+
+        v = std::move( w );
+        CHECK( v.size() == 1 );
+        CHECK( w.empty() ); // NOLINT(bugprone-use-after-move)
+    }
+
+    SECTION( "sort move-only elements" )
+    {
+        for ( int i : { 5, 3, 9, 1, 7, 2, 8 } )
+            v.emplace_back( std::make_unique< Tracked >( i ) );
+
+        v.sort( []( const auto& a, const auto& b ) {
+            return a->value < b->value;
+        } );
+        int expected[] = { 1, 2, 3, 5, 7, 8, 9 };
+        for ( std::size_t i = 0; i != v.size(); ++i )
+            CHECK( v[ i ]->value == expected[ i ] );
+        CHECK( Tracked::alive == 7 );
+    }
+
+    SECTION( "clear" )
+    {
+        v.emplace_back( std::make_unique< Tracked >( 1 ) );
+        v.reserve( 32 );
+        CHECK( v.capacity() >= 32 );
+        v.clear();
+        CHECK( v.empty() );
+        CHECK( v.capacity() >= 32 );
+        CHECK( Tracked::alive == 0 );
+    }
+
+    v.clear();
+    CHECK( Tracked::alive == 0 );
+}
+
+TEST_CASE( "non_null_vector with a non-trivially relocatable deleter", "[non_null_vector]" )
+{
+    nova::non_null_vector< std::unique_ptr< Tracked, DestroyingDeleter > > v;
+    for ( int i = 0; i != 20; ++i )
+        v.emplace_back( std::unique_ptr< Tracked, DestroyingDeleter >( new Tracked( i ) ) );
+    v.erase( v.begin() );
+    REQUIRE( v.size() == 19 );
+    CHECK( v.front()->value == 1 );
+    CHECK( v.front().underlying().get_deleter().tag == "deleter" );
+    CHECK( Tracked::alive == 19 );
+    v.clear();
+    CHECK( Tracked::alive == 0 );
+}
+
+TEST_CASE( "non_null_vector of shared_ptr", "[non_null_vector]" )
+{
+    nova::non_null_vector< std::shared_ptr< int > > v;
+    auto                                            sp = std::make_shared< int >( 1 );
+    v.push_back( nova::non_null_shared_ptr< int >( sp ) );
+    v.emplace_back( std::make_shared< int >( 2 ) );
+    CHECK( sp.use_count() == 2 );
+
+    nova::non_null_vector< std::shared_ptr< int > > copy( v );
+    CHECK( sp.use_count() == 3 );
+    CHECK( copy.size() == 2 );
+    CHECK( *copy[ 1 ] == 2 );
+
+    v.sort( std::greater<> {} );
+    CHECK( v.size() == 2 );
+}
+
+TEST_CASE( "non_null_vector of raw pointers", "[non_null_vector]" )
+{
+    int                           a = 1, b = 2, c = 3;
+    nova::non_null_vector< int* > v;
+    v.emplace_back( &a );
+    v.emplace_back( &b );
+    v.emplace_back( &c );
+
+    int sum = 0;
+    for ( nova::non_null< int* > p : v )
+        sum += *p;
+    CHECK( sum == 6 );
+
+    nova::non_null_vector< int* > w;
+    swap( v, w );
+    CHECK( v.empty() );
+    CHECK( w.size() == 3 );
+    CHECK( w.data()[ 2 ].get() == &c );
+}
+
+// =============================================================================
+// non_null_span / non_empty_span
+// =============================================================================
+
+static_assert( sizeof( nova::non_null_span< int > ) == 2 * sizeof( void* ) );
+static_assert( std::is_trivially_copyable_v< nova::non_null_span< int > > );
+static_assert( std::is_trivially_copyable_v< nova::non_empty_span< const int > > );
+static_assert( std::ranges::contiguous_range< nova::non_null_span< int > > );
+static_assert( std::ranges::borrowed_range< nova::non_null_span< int > > );
+static_assert( std::ranges::view< nova::non_empty_span< int > > );
+static_assert( !std::is_constructible_v< nova::non_null_span< int >, std::nullptr_t, std::size_t > );
+static_assert( !std::is_constructible_v< nova::non_null_span< int >, const std::vector< int >& > );
+static_assert( !std::is_convertible_v< std::vector< int >&, nova::non_empty_span< int > > );
+
+// std::span converts from the views through its range constructor.
+static_assert( std::is_convertible_v< nova::non_null_span< int >, std::span< int > > );
+static_assert( std::is_convertible_v< nova::non_empty_span< int >, std::span< const int > > );
+
+namespace {
+
+int sum( nova::non_null_span< const int > values )
+{
+    return std::accumulate( values.begin(), values.end(), 0 );
+}
+
+int first_plus_last( nova::non_empty_span< const int > values )
+{
+    return values.front() + values.back();
+}
+
+} // namespace
+
+TEST_CASE( "non_null_span", "[non_null_span]" )
+{
+    std::vector< int >     vec { 1, 2, 3, 4 };
+    std::array< int, 3 >   arr { 10, 20, 30 };
+    std::span< const int > sp( vec );
+
+    CHECK( sum( vec ) == 10 );
+    CHECK( sum( arr ) == 60 );
+    CHECK( sum( sp ) == 10 );
+
+    nova::non_null_span view( vec );
+    static_assert( std::is_same_v< decltype( view ), nova::non_null_span< int > > );
+    static_assert( std::is_same_v< decltype( view.data() ), nova::non_null< int* > > );
+    CHECK( view.data().get() == vec.data() );
+    CHECK( view.size() == 4 );
+    CHECK( view.size_bytes() == 4 * sizeof( int ) );
+    CHECK( view[ 2 ] == 3 );
+    CHECK( view.front() == 1 );
+    CHECK( view.back() == 4 );
+
+    view[ 0 ] = 5;
+    CHECK( vec[ 0 ] == 5 );
+
+    SECTION( "empty storage gets a non-null data pointer" )
+    {
+        std::vector< int > none;
+        REQUIRE( none.data() == nullptr );
+        nova::non_null_span< int > empty( none );
+        CHECK( empty.empty() );
+        CHECK( empty.data().get() != nullptr );
+        CHECK( empty.begin() == empty.end() );
+        CHECK( sum( empty ) == 0 );
+    }
+
+    SECTION( "sub-views" )
+    {
+        CHECK( sum( view.first( 2 ) ) == 7 );
+        CHECK( sum( view.last( 2 ) ) == 7 );
+        CHECK( sum( view.subspan( 1 ) ) == 9 );
+        CHECK( sum( view.subspan( 1, 2 ) ) == 5 );
+        CHECK( view.subspan( 4 ).empty() );
+    }
+
+    SECTION( "conversions" )
+    {
+        nova::non_null_span< const int > const_view = view;
+        std::span< const int >           std_view   = const_view;
+        CHECK( std_view.data() == vec.data() );
+        CHECK( std_view.size() == 4 );
+
+        nova::non_null_span from_non_null( nova::non_null( arr.data() ), 2 );
+        CHECK( sum( from_non_null ) == 30 );
+    }
+}
+
+TEST_CASE( "non_empty_span", "[non_null_span]" )
+{
+    std::vector< int > vec { 3, 4, 5 };
+
+    nova::non_empty_span view( vec );
+    static_assert( std::is_same_v< decltype( view ), nova::non_empty_span< int > > );
+    CHECK_FALSE( view.empty() );
+    CHECK( view.size() == 3 );
+    CHECK( view.front() == 3 );
+    CHECK( view.back() == 5 );
+    CHECK( first_plus_last( view ) == 8 );
+    CHECK( first_plus_last( nova::non_empty_span< const int >( std::array { 1 } ) ) == 2 );
+
+    // a non_empty_span is a non_null_span
+    CHECK( sum( view ) == 12 );
+
+    auto maybe = nova::try_make_non_empty_span( vec );
+    REQUIRE( maybe.has_value() );
+    CHECK( maybe->size() == 3 );
+
+    std::vector< int > none;
+    CHECK_FALSE( nova::try_make_non_empty_span( none ).has_value() );
+
+    using checked = nova::non_empty_span< int, nova::contract_throw >;
+    CHECK_THROWS_AS( checked( none ), nova::contract_violation_error );
+    CHECK_THROWS_AS( checked( nova::non_null( vec.data() ), 0 ), nova::contract_violation_error );
+    CHECK( checked( vec ).back() == 5 );
+}
+
+// =============================================================================
+// non_null_flat_set / non_null_flat_map
+// =============================================================================
+
+static_assert( sizeof( nova::optional_non_null< int* > ) == sizeof( int* ) );
+static_assert( sizeof( nova::optional_non_null< std::shared_ptr< int > > ) == sizeof( std::shared_ptr< int > ) );
+static_assert( std::forward_iterator< nova::non_null_flat_set< int* >::iterator > );
+static_assert( std::is_nothrow_move_constructible_v< nova::non_null_flat_map< int*, std::string > > );
+
+TEST_CASE( "non_null_flat_set of raw pointers", "[non_null_flat_set]" )
+{
+    std::vector< int >              storage( 100 );
+    nova::non_null_flat_set< int* > set;
+    CHECK( set.empty() );
+    CHECK( set.capacity() == 0 );
+    CHECK_FALSE( set.contains( &storage[ 0 ] ) );
+
+    for ( int& v : storage )
+        CHECK( set.insert( nova::non_null( &v ) ).second );
+    CHECK_FALSE( set.insert( nova::non_null( &storage[ 7 ] ) ).second );
+    CHECK( set.size() == 100 );
+    CHECK( set.capacity() * 7 >= set.size() * 8 );
+
+    // Transparent lookup: raw pointers, non_null and null all work.
+    CHECK( set.contains( &storage[ 42 ] ) );
+    CHECK( set.contains( nova::non_null( &storage[ 42 ] ) ) );
+    CHECK( set.count( static_cast< int* >( nullptr ) ) == 0 );
+    int other = 0;
+    CHECK_FALSE( set.contains( &other ) );
+    CHECK( ( *set.find( &storage[ 3 ] ) ).get() == &storage[ 3 ] );
+    CHECK( set.find( &other ) == set.end() );
+
+    // Backward-shift deletion keeps every remaining key reachable.
+    for ( std::size_t i = 0; i < storage.size(); i += 3 )
+        CHECK( set.erase( &storage[ i ] ) == 1 );
+    CHECK( set.erase( &storage[ 0 ] ) == 0 );
+    for ( std::size_t i = 0; i != storage.size(); ++i )
+        CHECK( set.contains( &storage[ i ] ) == ( i % 3 != 0 ) );
+
+    std::size_t visited = 0;
+    for ( nova::non_null< int* > p : set ) {
+        CHECK( ( p.get() - storage.data() ) % 3 != 0 );
+        ++visited;
+    }
+    CHECK( visited == set.size() );
+
+    const auto copy = set;
+    CHECK( copy == set );
+    set.clear();
+    CHECK( set.empty() );
+    CHECK( copy != set );
+    CHECK( set.begin() == set.end() );
+}
+
+TEST_CASE( "non_null_flat_set matches std::unordered_set", "[non_null_flat_set]" )
+{
+    std::vector< int >              storage( 512 );
+    nova::non_null_flat_set< int* > set;
+    std::unordered_set< int* >      reference;
+
+    // A fixed linear congruential sequence of inserts, erases and lookups.
+    std::uint32_t state = 1;
+    for ( int round = 0; round != 20000; ++round ) {
+        state  = state * 1664525u + 1013904223u;
+        int* p = &storage[ ( state >> 8 ) % storage.size() ];
+        switch ( state % 3 ) {
+        case 0:
+            REQUIRE( set.insert( nova::non_null( p ) ).second == reference.insert( p ).second );
+            break;
+        case 1:
+            REQUIRE( set.erase( p ) == reference.erase( p ) );
+            break;
+        default:
+            REQUIRE( set.contains( p ) == reference.contains( p ) );
+        }
+        REQUIRE( set.size() == reference.size() );
+    }
+    for ( nova::non_null< int* > p : set )
+        CHECK( reference.contains( p.get() ) );
+}
+
+TEST_CASE( "non_null_flat_set of shared_ptr", "[non_null_flat_set]" )
+{
+    auto a = std::make_shared< int >( 1 );
+    auto b = std::make_shared< int >( 2 );
+
+    nova::non_null_flat_set< std::shared_ptr< int > > set { nova::non_null( a ), nova::non_null( b ) };
+    CHECK( set.size() == 2 );
+    CHECK( a.use_count() == 2 );
+    CHECK( set.contains( a.get() ) );
+    CHECK( set.contains( a ) );
+
+    set.reserve( 100 ); // rehashing moves the owners, it does not copy them
+    CHECK( a.use_count() == 2 );
+    CHECK( set.erase( a.get() ) == 1 );
+    CHECK( a.use_count() == 1 );
+    CHECK( *( *set.begin() ) == 2 );
+}
+
+namespace {
+
+struct LeftBase
+{
+    int left = 1;
+};
+
+struct RightBase
+{
+    int right = 2;
+};
+
+struct Joined : LeftBase, RightBase
+{};
+
+template < typename Set, typename K >
+concept can_look_up = requires( const Set& set, const K& key ) { set.contains( key ); };
+
+} // namespace
+
+static_assert( !std::is_invocable_v< nova::pointer_equal, RightBase*, Joined* > );
+static_assert( std::is_invocable_v< nova::pointer_equal, RightBase*, nova::non_null< RightBase* > > );
+static_assert( std::is_invocable_v< nova::pointer_equal, RightBase*, const void* > );
+static_assert( can_look_up< nova::non_null_flat_set< RightBase* >, Joined* > );
+static_assert( !can_look_up< nova::non_null_flat_set< RightBase* >, int* > );
+static_assert( !can_look_up< nova::non_null_flat_set< Joined* >, RightBase* > );
+
+TEST_CASE( "non_null_flat_set finds keys through a derived pointer at another address",
+           "[non_null_flat_set][non_null_flat_map]" )
+{
+    Joined     object;
+    RightBase* base = &object;
+    REQUIRE( static_cast< const void* >( base ) != static_cast< const void* >( &object ) );
+
+    nova::non_null_flat_set< RightBase* > set { nova::non_null( base ) };
+    CHECK( set.contains( &object ) );
+    CHECK( set.find( &object ) != set.end() );
+    CHECK( set.erase( &object ) == 1 );
+    CHECK( set.empty() );
+
+    nova::non_null_flat_map< RightBase*, int > map;
+    map.try_emplace( nova::non_null( base ), 5 );
+    CHECK( map.at( &object ) == 5 );
+    CHECK( map.find( &object ) != map.end() );
+    CHECK( map.erase( &object ) == 1 );
+}
+
+TEST_CASE( "non_null_flat_map", "[non_null_flat_map]" )
+{
+    std::vector< int >                                                            storage( 50 );
+    nova::non_null_flat_map< int*, std::string >                                  map;
+    nova::non_null_flat_map< std::shared_ptr< Tracked >, std::unique_ptr< int > > owners;
+
+    for ( std::size_t i = 0; i != storage.size(); ++i )
+        map[ nova::non_null( &storage[ i ] ) ] = std::to_string( i );
+    CHECK( map.size() == 50 );
+    CHECK( map.at( &storage[ 10 ] ) == "10" );
+    CHECK_THROWS_AS( map.at( static_cast< int* >( nullptr ) ), std::out_of_range );
+
+    CHECK_FALSE( map.try_emplace( nova::non_null( &storage[ 1 ] ), "one" ).second );
+    CHECK( map.insert_or_assign( nova::non_null( &storage[ 1 ] ), "one" ).first->second == "one" );
+
+    for ( std::size_t i = 0; i < storage.size(); i += 2 )
+        map.erase( &storage[ i ] );
+    CHECK( map.size() == 25 );
+    CHECK( map.at( &storage[ 49 ] ) == "49" );
+    CHECK( map.find( &storage[ 48 ] ) == map.end() );
+
+    for ( auto&& [ key, value ] : map )
+        value += "!";
+    const auto& cmap = map;
+    CHECK( cmap.find( &storage[ 1 ] )->second == "one!" );
+    CHECK( cmap.find( &storage[ 1 ] )->first.get() == &storage[ 1 ] );
+
+    {
+        auto key = std::make_shared< Tracked >( 5 );
+        owners.try_emplace( nova::non_null( key ), std::make_unique< int >( 6 ) );
+        CHECK( *owners.at( key.get() ) == 6 );
+        CHECK( Tracked::alive == 1 );
+    }
+    CHECK( Tracked::alive == 1 );
+    owners.clear();
+    CHECK( Tracked::alive == 0 );
+}
+
+namespace {
+
+int live_allocations = 0;
+
+template < typename T >
+struct CountingAllocator
+{
+    using value_type = T;
+
+    CountingAllocator() = default;
+    template < typename U >
+    CountingAllocator( const CountingAllocator< U >& ) noexcept
+    {}
+
+    T* allocate( std::size_t n )
+    {
+        ++live_allocations;
+        return std::allocator< T >().allocate( n );
+    }
+
+    void deallocate( T* p, std::size_t n ) noexcept
+    {
+        --live_allocations;
+        std::allocator< T >().deallocate( p, n );
+    }
+
+    friend bool operator==( const CountingAllocator&, const CountingAllocator& ) noexcept
+    {
+        return true;
+    }
+};
+
+// Copying throws once copies_left reaches zero.
+struct CopyThrower
+{
+    static inline int alive       = 0;
+    static inline int copies_left = 0;
+
+    CopyThrower()
+    {
+        ++alive;
+    }
+    CopyThrower( const CopyThrower& )
+    {
+        if ( copies_left-- == 0 )
+            throw std::runtime_error( "copy" );
+        ++alive;
+    }
+    CopyThrower( CopyThrower&& ) noexcept
+    {
+        ++alive;
+    }
+    ~CopyThrower()
+    {
+        --alive;
+    }
+};
+
+} // namespace
+
+TEST_CASE( "non_null_flat_map copy releases everything if a value copy throws", "[non_null_flat_map]" )
+{
+    using map_type = nova::non_null_flat_map< int*, CopyThrower, nova::pointer_hash, CountingAllocator< int* > >;
+
+    std::array< int, 4 > storage {};
+    {
+        map_type map;
+        for ( int& i : storage )
+            map[ nova::non_null( &i ) ];
+        const int allocations = live_allocations;
+
+        CopyThrower::copies_left = 2;
+        CHECK_THROWS_AS( map_type( map ), std::runtime_error );
+        CHECK( CopyThrower::alive == 4 );
+        CHECK( live_allocations == allocations );
+    }
+    CHECK( CopyThrower::alive == 0 );
+    CHECK( live_allocations == 0 );
+}
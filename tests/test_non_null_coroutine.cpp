@@ -0,0 +1,286 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2026 Tim Blechmann
+
+#include <coroutine>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <nova/non_null.hpp>
+
+namespace {
+
+// A lazily started coroutine that resumes its continuation when it finishes.
+struct Task
+{
+    struct promise_type;
+    using handle = nova::non_null_coroutine_handle< promise_type >;
+
+    struct final_awaiter
+    {
+        bool await_ready() noexcept
+        {
+            return false;
+        }
+
+#if defined( __cpp_lib_move_only_function ) && __cpp_lib_move_only_function >= 202110L
+        std::coroutine_handle<> await_suspend( std::coroutine_handle< promise_type > h ) noexcept
+        {
+            return h.promise().continuation.transfer();
+        }
+#else
+        std::coroutine_handle<> await_suspend( std::coroutine_handle< promise_type > h ) noexcept
+        {
+            return h.promise().continuation;
+        }
+#endif
+
+        void await_resume() noexcept
+        {}
+    };
+
+    struct promise_type
+    {
+#if defined( __cpp_lib_move_only_function ) && __cpp_lib_move_only_function >= 202110L
+        nova::non_null_continuation continuation = nova::non_null_coroutine_handle<>::noop();
+#else
+        nova::non_null_coroutine_handle<> continuation = nova::non_null_coroutine_handle<>::noop();
+#endif
+
+        Task get_return_object() noexcept
+        {
+            return Task( handle::from_promise( *this ) );
+        }
+
+        std::suspend_always initial_suspend() noexcept
+        {
+            return {};
+        }
+
+        final_awaiter final_suspend() noexcept
+        {
+            return {};
+        }
+
+        void return_void() noexcept
+        {}
+
+        void unhandled_exception()
+        {
+            throw;
+        }
+    };
+
+    explicit Task( handle h ) noexcept :
+        coro( h )
+    {}
+
+    Task( const Task& )            = delete;
+    Task& operator=( const Task& ) = delete;
+
+    ~Task()
+    {
+        coro.destroy();
+    }
+
+    bool await_ready() noexcept
+    {
+        return false;
+    }
+
+    // Symmetric transfer into the child: no null check on either handle.
+    std::coroutine_handle<> await_suspend( std::coroutine_handle<> parent ) noexcept
+    {
+        coro.promise().continuation = nova::non_null_coroutine_handle<>( parent );
+        return coro;
+    }
+
+    void await_resume() noexcept
+    {}
+
+    handle coro;
+};
+
+Task record( std::vector< int >& log, int value )
+{
+    log.push_back( value );
+    co_return;
+}
+
+Task await_child( std::vector< int >& log )
+{
+    log.push_back( 1 );
+    co_await record( log, 2 );
+    log.push_back( 3 );
+}
+
+} // namespace
+
+// =============================================================================
+// non_null_coroutine_handle tests
+// =============================================================================
+
+TEST_CASE( "non_null_coroutine_handle - resume and promise", "[non_null_coroutine_handle]" )
+{
+    std::vector< int > log;
+    Task               task = record( log, 7 );
+
+    CHECK( log.empty() );
+    CHECK( !task.coro.done() );
+    CHECK( &task.coro.promise() == &task.coro.get().promise() );
+
+    task.coro.resume();
+    CHECK( log == std::vector< int > { 7 } );
+    CHECK( task.coro.done() );
+}
+
+TEST_CASE( "non_null_coroutine_handle - type-erased conversion and comparison", "[non_null_coroutine_handle]" )
+{
+    std::vector< int > log;
+    Task               task = record( log, 1 );
+
+    nova::non_null_coroutine_handle<> erased = task.coro;
+    CHECK( erased.address() == task.coro.address() );
+    CHECK( erased == nova::non_null_coroutine_handle<>( std::coroutine_handle<>( task.coro ) ) );
+    CHECK( erased != nova::non_null_coroutine_handle<>::noop() );
+
+    std::unordered_set< nova::non_null_coroutine_handle<> > set { erased };
+    CHECK( set.contains( erased ) );
+
+    erased();
+    CHECK( log == std::vector< int > { 1 } );
+}
+
+TEST_CASE( "non_null_coroutine_handle - a null handle violates the contract", "[non_null_coroutine_handle]" )
+{
+    using handle = nova::non_null_coroutine_handle< void, nova::contract_throw >;
+    CHECK_THROWS_AS( handle( std::coroutine_handle<>() ), nova::contract_violation_error );
+
+    // The noop coroutine can be resumed any number of times.
+    auto noop = handle::noop();
+    noop.resume();
+    CHECK( !noop.done() );
+}
+
+TEST_CASE( "non_null_coroutine_handle - symmetric transfer to a continuation", "[non_null_coroutine_handle]" )
+{
+    std::vector< int > log;
+    Task               task = await_child( log );
+
+    task.coro.resume();
+    CHECK( log == std::vector< int > { 1, 2, 3 } );
+    CHECK( task.coro.done() );
+}
+
+static_assert( sizeof( nova::non_null_coroutine_handle<> ) == sizeof( void* ) );
+static_assert( std::is_trivially_copyable_v< nova::non_null_coroutine_handle<> > );
+static_assert( !std::is_default_constructible_v< nova::non_null_coroutine_handle<> > );
+static_assert( !std::is_constructible_v< nova::non_null_coroutine_handle<>, std::nullptr_t > );
+static_assert( !std::is_convertible_v< std::coroutine_handle<>, nova::non_null_coroutine_handle<> > );
+static_assert( std::is_convertible_v< nova::non_null_coroutine_handle< Task::promise_type >,
+                                      nova::non_null_coroutine_handle<> > );
+static_assert( !std::is_convertible_v< nova::non_null_coroutine_handle<>,
+                                       nova::non_null_coroutine_handle< Task::promise_type > > );
+static_assert( nova::is_trivially_relocatable_v< nova::non_null_coroutine_handle<> > );
+
+#if defined( __cpp_lib_move_only_function ) && __cpp_lib_move_only_function >= 202110L
+
+// =============================================================================
+// non_null_continuation tests
+// =============================================================================
+
+TEST_CASE( "non_null_continuation - coroutine continuation", "[non_null_continuation]" )
+{
+    std::vector< int > log;
+    Task               task = record( log, 4 );
+
+    nova::non_null_continuation cont = task.coro;
+    CHECK( cont.holds_coroutine() );
+    CHECK( cont.coroutine() == nova::non_null_coroutine_handle<>( task.coro ) );
+    CHECK( cont.transfer() == nova::non_null_coroutine_handle<>( task.coro ) );
+
+    cont.resume();
+    CHECK( log == std::vector< int > { 4 } );
+}
+
+TEST_CASE( "non_null_continuation - callable continuation", "[non_null_continuation]" )
+{
+    int                         calls = 0;
+    nova::non_null_continuation cont  = nova::non_null_move_only_function< void() >( [ &calls ] {
+        ++calls;
+    } );
+    CHECK( !cont.holds_coroutine() );
+
+    cont();
+    CHECK( calls == 1 );
+
+    // transfer() runs the callable and hands back the noop coroutine.
+    CHECK( cont.transfer() == nova::non_null_coroutine_handle<>::noop() );
+    CHECK( calls == 2 );
+}
+
+TEST_CASE( "non_null_continuation - resumed by a finishing task", "[non_null_continuation]" )
+{
+    std::vector< int > log;
+    Task               task = record( log, 5 );
+
+    task.coro.promise().continuation = nova::non_null_move_only_function< void() >( [ &log ] {
+        log.push_back( 6 );
+    } );
+    task.coro.resume();
+    CHECK( log == std::vector< int > { 5, 6 } );
+}
+
+TEST_CASE( "non_null_continuation - moved-from holds the noop coroutine", "[non_null_continuation]" )
+{
+    auto                        owner = std::make_shared< int >( 1 );
+    nova::non_null_continuation src   = nova::non_null_move_only_function< void() >( [ owner ] {} );
+    CHECK( owner.use_count() == 2 );
+
+    nova::non_null_continuation dst = std::move( src );
+    CHECK( owner.use_count() == 2 );
+    CHECK( !dst.holds_coroutine() );
+    CHECK( src.holds_coroutine() );
+    CHECK( src.coroutine() == nova::non_null_coroutine_handle<>::noop() );
+    src.resume(); // a no-op
+
+    dst = std::move( src );
+    CHECK( owner.use_count() == 1 );
+    CHECK( dst.holds_coroutine() );
+}
+
+TEST_CASE( "non_null_continuation - moved-from coroutine continuation holds the noop coroutine",
+           "[non_null_continuation]" )
+{
+    std::vector< int > log;
+    Task               task = record( log, 7 );
+
+    nova::non_null_continuation src = task.coro;
+    nova::non_null_continuation dst = std::move( src );
+    CHECK( dst.coroutine() == nova::non_null_coroutine_handle<>( task.coro ) );
+    CHECK( src.coroutine() == nova::non_null_coroutine_handle<>::noop() );
+    src.resume(); // a no-op
+    CHECK( log.empty() );
+
+    src = std::move( dst );
+    CHECK( src.coroutine() == nova::non_null_coroutine_handle<>( task.coro ) );
+    CHECK( dst.coroutine() == nova::non_null_coroutine_handle<>::noop() );
+
+    src.resume();
+    CHECK( log == std::vector< int > { 7 } );
+}
+
+static_assert( !std::is_copy_constructible_v< nova::non_null_continuation > );
+static_assert( std::is_nothrow_move_constructible_v< nova::non_null_continuation > );
+static_assert( std::is_nothrow_move_assignable_v< nova::non_null_continuation > );
+static_assert( !std::is_default_constructible_v< nova::non_null_continuation > );
+static_assert( !std::is_constructible_v< nova::non_null_continuation, std::nullptr_t > );
+static_assert( sizeof( nova::non_null_continuation )
+               == sizeof( void* ) + sizeof( std::move_only_function< void() > ) );
+
+#endif // __cpp_lib_move_only_function
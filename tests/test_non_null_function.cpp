@@ -1,8 +1,15 @@
 // SPDX-License-Identifier: MIT
 // SPDX-FileCopyrightText: 2026 Tim Blechmann
 
+#include <array>
+#include <atomic>
 #include <functional>
+#include <memory>
+#include <memory_resource>
+#include <stdexcept>
+#include <thread>
 #include <type_traits>
+#include <vector>
 
 #include <catch2/catch_test_macros.hpp>
 
@@ -157,6 +164,278 @@ TEST_CASE( "non_null_function - result_type and function_type aliases", "[non_nu
 // Null construction must be deleted (compile-time enforcement)
 static_assert( !std::is_constructible_v< nova::non_null_function< int() >, std::nullptr_t > );
 
+namespace {
+
+int negate( int x ) noexcept
+{
+    return -x;
+}
+
+} // namespace
+
+TEST_CASE( "non_null_function - noexcept signature", "[non_null_function]" )
+{
+    nova::non_null_function< int( int ) noexcept > fn( []( int x ) noexcept {
+        return x + 1;
+    } );
+    static_assert( noexcept( fn( 1 ) ) );
+    static_assert( std::is_same_v< decltype( fn )::function_type, std::function< int( int ) > > );
+    CHECK( fn( 1 ) == 2 );
+
+    nova::non_null_function deduced( &negate );
+    static_assert( std::is_same_v< decltype( deduced ), nova::non_null_function< int( int ) noexcept > > );
+    CHECK( deduced( 3 ) == -3 );
+
+    auto copy = deduced;
+    CHECK( copy( 4 ) == -4 );
+}
+
+// A noexcept signature rejects callables that may throw
+static_assert( !std::is_constructible_v< nova::non_null_function< int( int ) noexcept >, int ( * )( int ) > );
+static_assert( std::is_constructible_v< nova::non_null_function< int( int ) >, int ( * )( int ) noexcept > );
+
+// =============================================================================
+// non_null_function_ref tests
+// =============================================================================
+
+namespace {
+
+int call_with_21( nova::non_null_function_ref< int( int ) > fn )
+{
+    return fn( 21 );
+}
+
+int twice( int x )
+{
+    return x * 2;
+}
+
+} // namespace
+
+TEST_CASE( "non_null_function_ref - reference to lambda", "[non_null_function_ref]" )
+{
+    int  calls = 0;
+    auto l     = [ & ]( int x ) {
+        ++calls;
+        return x + 1;
+    };
+    nova::non_null_function_ref< int( int ) > fn( l );
+    CHECK( fn( 41 ) == 42 );
+    CHECK( calls == 1 );
+}
+
+TEST_CASE( "non_null_function_ref - temporary lambda as parameter", "[non_null_function_ref]" )
+{
+    CHECK( call_with_21( []( int x ) {
+               return x * 2;
+           } )
+           == 42 );
+}
+
+TEST_CASE( "non_null_function_ref - stateful callable is referenced, not copied", "[non_null_function_ref]" )
+{
+    struct Counter
+    {
+        int  count = 0;
+        void operator()()
+        {
+            ++count;
+        }
+    };
+
+    Counter                               c;
+    nova::non_null_function_ref< void() > fn( c );
+    fn();
+    fn();
+    CHECK( c.count == 2 );
+}
+
+TEST_CASE( "non_null_function_ref - const callable", "[non_null_function_ref]" )
+{
+    const auto                                l = []( int x ) {
+        return x - 1;
+    };
+    nova::non_null_function_ref< int( int ) > fn( l );
+    CHECK( fn( 43 ) == 42 );
+}
+
+TEST_CASE( "non_null_function_ref - function pointer", "[non_null_function_ref]" )
+{
+    nova::non_null_function_ref< int( int ) > fn( &twice );
+    CHECK( fn( 21 ) == 42 );
+
+    nova::non_null_function_ref< long( int ) > converting( twice );
+    CHECK( converting( 4 ) == 8L );
+}
+
+TEST_CASE( "non_null_function_ref - deduction guide from function pointer", "[non_null_function_ref]" )
+{
+    nova::non_null_function_ref fn( &twice );
+    static_assert( std::is_same_v< decltype( fn ), nova::non_null_function_ref< int( int ) > > );
+    CHECK( fn( 5 ) == 10 );
+}
+
+TEST_CASE( "non_null_function_ref - reference to non_null_function", "[non_null_function_ref]" )
+{
+    nova::non_null_function< int( int ) > owner( []( int x ) {
+        return x * 3;
+    } );
+    CHECK( call_with_21( owner ) == 63 );
+}
+
+TEST_CASE( "non_null_function_ref - move-only arguments and void result", "[non_null_function_ref]" )
+{
+    int  received = 0;
+    auto sink     = [ & ]( std::unique_ptr< int > p ) {
+        received = *p;
+        return 1; // discarded
+    };
+    nova::non_null_function_ref< void( std::unique_ptr< int > ) > fn( sink );
+    fn( std::make_unique< int >( 42 ) );
+    CHECK( received == 42 );
+}
+
+TEST_CASE( "non_null_function_ref - copy, assignment and swap", "[non_null_function_ref]" )
+{
+    auto one = [] {
+        return 1;
+    };
+    auto two = [] {
+        return 2;
+    };
+
+    nova::non_null_function_ref< int() > fn1( one );
+    nova::non_null_function_ref< int() > fn2( two );
+    nova::non_null_function_ref< int() > fn3( fn1 );
+    CHECK( fn3() == 1 );
+
+    fn3 = fn2;
+    CHECK( fn3() == 2 );
+
+    using std::swap;
+    swap( fn1, fn2 );
+    CHECK( fn1() == 2 );
+    CHECK( fn2() == 1 );
+    CHECK( static_cast< bool >( fn1 ) );
+}
+
+static_assert( sizeof( nova::non_null_function_ref< void() > ) == 2 * sizeof( void* ) );
+static_assert( std::is_trivially_copyable_v< nova::non_null_function_ref< int( int ) > > );
+static_assert( std::is_same_v< nova::non_null_function_ref< int( double ) >::result_type, int > );
+static_assert( !std::is_constructible_v< nova::non_null_function_ref< int() >, std::nullptr_t > );
+static_assert( !std::is_default_constructible_v< nova::non_null_function_ref< int() > > );
+
+// =============================================================================
+// non_null_fn_ptr tests
+// =============================================================================
+
+namespace {
+
+constexpr nova::non_null_fn_ptr< int( int ) > constant_square = []( int x ) {
+    return x * x;
+};
+static_assert( constant_square( 7 ) == 49 );
+
+int apply_twice( nova::non_null_fn_ptr< int( int ) > fn, int x )
+{
+    return fn( fn( x ) );
+}
+
+} // namespace
+
+TEST_CASE( "non_null_fn_ptr - construction from function pointer and lambda", "[non_null_fn_ptr]" )
+{
+    nova::non_null_fn_ptr< int( int ) > fn( &twice );
+    CHECK( fn( 21 ) == 42 );
+    CHECK( fn.get() == &twice );
+    CHECK( static_cast< bool >( fn ) );
+
+    CHECK( apply_twice(
+               []( int x ) {
+                   return x + 1;
+               },
+               1 )
+           == 3 );
+
+    nova::non_null_fn_ptr deduced_ptr( &negate );
+    static_assert( std::is_same_v< decltype( deduced_ptr ), nova::non_null_fn_ptr< int( int ) noexcept > > );
+    static_assert( noexcept( deduced_ptr( 1 ) ) );
+    CHECK( deduced_ptr( 5 ) == -5 );
+
+    nova::non_null_fn_ptr deduced_lambda = []( int x, int y ) {
+        return x - y;
+    };
+    static_assert( std::is_same_v< decltype( deduced_lambda ), nova::non_null_fn_ptr< int( int, int ) > > );
+    CHECK( deduced_lambda( 5, 3 ) == 2 );
+}
+
+TEST_CASE( "non_null_fn_ptr - copy, compare, swap and hash", "[non_null_fn_ptr]" )
+{
+    nova::non_null_fn_ptr< int( int ) > a( &twice );
+    nova::non_null_fn_ptr< int( int ) > b = constant_square;
+    nova::non_null_fn_ptr< int( int ) > c = a;
+    CHECK( a == c );
+    CHECK( a != b );
+
+    swap( a, b );
+    CHECK( a( 3 ) == 9 );
+    CHECK( b( 3 ) == 6 );
+
+    c = a;
+    CHECK( c( 4 ) == 16 );
+
+    // A noexcept pointer converts to the potentially-throwing signature
+    nova::non_null_fn_ptr< int( int ) > from_noexcept = nova::non_null_fn_ptr( &negate );
+    CHECK( from_noexcept( 2 ) == -2 );
+
+    CHECK( std::hash< nova::non_null_fn_ptr< int( int ) > > {}( c ) == std::hash< int ( * )( int ) > {}( c.get() ) );
+}
+
+TEST_CASE( "non_null_fn_ptr - converts to the owning and non-owning wrappers", "[non_null_fn_ptr]" )
+{
+    nova::non_null_fn_ptr< int( int ) > fn( &twice );
+
+    nova::non_null_function< int( int ) > owning = fn;
+    CHECK( owning( 4 ) == 8 );
+    CHECK( *owning.underlying().target< int ( * )( int ) >() == &twice );
+
+    // The pointer is stored by value: the source may go away
+    nova::non_null_function_ref< int( int ) > ref = nova::non_null_fn_ptr< int( int ) >( &twice );
+    CHECK( ref( 5 ) == 10 );
+    CHECK( call_with_21( fn ) == 42 );
+
+    nova::non_null_function< int( int ) noexcept > owning_noexcept = nova::non_null_fn_ptr( &negate );
+    CHECK( owning_noexcept( 1 ) == -1 );
+
+#if defined( __cpp_lib_move_only_function ) && __cpp_lib_move_only_function >= 202110L
+    nova::non_null_move_only_function< int( int ) > move_only( fn );
+    CHECK( move_only( 6 ) == 12 );
+#endif
+}
+
+TEST_CASE( "non_null_fn_ptr contract policies", "[non_null_fn_ptr][contract]" )
+{
+    using checked = nova::non_null_fn_ptr< int( int ), nova::contract_throw >;
+
+    int ( *null_fn )( int ) = nullptr;
+    CHECK_THROWS_AS( checked( null_fn ), nova::contract_violation_error );
+    CHECK( checked( &twice )( 2 ) == 4 );
+}
+
+static_assert( sizeof( nova::non_null_fn_ptr< void() > ) == sizeof( void ( * )() ) );
+static_assert( std::is_trivially_copyable_v< nova::non_null_fn_ptr< int( int ) > > );
+static_assert( std::is_trivially_destructible_v< nova::non_null_fn_ptr< int( int ) > > );
+static_assert( nova::is_trivially_relocatable_v< nova::non_null_fn_ptr< int( int ) > > );
+static_assert( !std::is_constructible_v< nova::non_null_fn_ptr< int() >, std::nullptr_t > );
+static_assert( !std::is_default_constructible_v< nova::non_null_fn_ptr< int() > > );
+static_assert( !std::is_convertible_v< int ( * )( int ), nova::non_null_fn_ptr< int( int ) > > );
+// A noexcept signature rejects potentially-throwing functions and lambdas
+static_assert( !std::is_constructible_v< nova::non_null_fn_ptr< int( int ) noexcept >, int ( * )( int ) > );
+static_assert( !std::is_constructible_v< nova::non_null_fn_ptr< int( int ) noexcept >,
+                                         nova::non_null_fn_ptr< int( int ) > > );
+// Stateful lambdas have no function pointer
+static_assert( !std::is_constructible_v< nova::non_null_fn_ptr< int() >, decltype( [ x = 1 ] { return x; } ) > );
+
 // =============================================================================
 // non_null_move_only_function tests  (C++23 only)
 // =============================================================================
@@ -260,4 +539,580 @@ static_assert( !std::is_move_assignable_v< nova::non_null_move_only_function< in
 // Null construction must be deleted
 static_assert( !std::is_constructible_v< nova::non_null_move_only_function< int() >, std::nullptr_t > );
 
+TEST_CASE( "non_null_move_only_function - qualified signatures", "[non_null_move_only_function]" )
+{
+    SECTION( "noexcept" )
+    {
+        nova::non_null_move_only_function< int( int ) noexcept > fn( []( int x ) noexcept {
+            return x * 3;
+        } );
+        static_assert( noexcept( fn( 1 ) ) );
+        CHECK( fn( 2 ) == 6 );
+
+        std::move_only_function< int( int ) noexcept > raw = take( std::move( fn ) );
+        CHECK( raw( 3 ) == 9 );
+    }
+
+    SECTION( "const" )
+    {
+        const nova::non_null_move_only_function< int() const > fn( [] {
+            return 5;
+        } );
+        CHECK( fn() == 5 );
+        static_assert( std::is_same_v< decltype( fn )::function_type, std::move_only_function< int() const > > );
+    }
+
+    SECTION( "lvalue and rvalue ref" )
+    {
+        nova::non_null_move_only_function< int() & > lvalue_fn( [ n = 0 ]() mutable {
+            return ++n;
+        } );
+        CHECK( lvalue_fn() == 1 );
+        CHECK( lvalue_fn() == 2 );
+
+        auto                                                   up = std::make_unique< int >( 11 );
+        nova::non_null_move_only_function< int() && noexcept > once( [ p = std::move( up ) ]() noexcept {
+            return *p;
+        } );
+        CHECK( std::move( once )() == 11 );
+    }
+
+    SECTION( "const rvalue ref" )
+    {
+        const nova::non_null_move_only_function< int( int ) const&& > fn( []( int x ) {
+            return x;
+        } );
+        CHECK( std::move( fn )( 8 ) == 8 );
+    }
+}
+
+namespace {
+
+struct MutableCallable
+{
+    int operator()()
+    {
+        return 0;
+    }
+};
+
+struct ThrowingCallable
+{
+    int operator()() const
+    {
+        return 0;
+    }
+};
+
+} // namespace
+
+// The call operator carries the signature's qualifiers
+static_assert( std::is_invocable_v< const nova::non_null_move_only_function< int() const >& > );
+static_assert( !std::is_invocable_v< const nova::non_null_move_only_function< int() >& > );
+static_assert( std::is_nothrow_invocable_v< nova::non_null_move_only_function< int() noexcept >& > );
+static_assert( !std::is_nothrow_invocable_v< nova::non_null_move_only_function< int() >& > );
+static_assert( std::is_invocable_v< nova::non_null_move_only_function< int() && > > );
+static_assert( !std::is_invocable_v< nova::non_null_move_only_function< int() && >& > );
+static_assert( !std::is_invocable_v< nova::non_null_move_only_function< int() & > > );
+
+// ... and constrains the callables it accepts
+static_assert( !std::is_constructible_v< nova::non_null_move_only_function< int() const >, MutableCallable > );
+static_assert( std::is_constructible_v< nova::non_null_move_only_function< int() >, MutableCallable > );
+static_assert( !std::is_constructible_v< nova::non_null_move_only_function< int() noexcept >, ThrowingCallable > );
+static_assert( !std::is_move_constructible_v< nova::non_null_move_only_function< int() const noexcept > > );
+static_assert( !std::is_constructible_v< nova::non_null_move_only_function< int() const& >, std::nullptr_t > );
+
+namespace {
+
+class CountingResource : public std::pmr::memory_resource
+{
+public:
+    int allocations   = 0;
+    int deallocations = 0;
+
+private:
+    void* do_allocate( std::size_t bytes, std::size_t alignment ) override
+    {
+        ++allocations;
+        return std::pmr::new_delete_resource()->allocate( bytes, alignment );
+    }
+
+    void do_deallocate( void* p, std::size_t bytes, std::size_t alignment ) override
+    {
+        ++deallocations;
+        std::pmr::new_delete_resource()->deallocate( p, bytes, alignment );
+    }
+
+    bool do_is_equal( const std::pmr::memory_resource& other ) const noexcept override
+    {
+        return this == &other;
+    }
+};
+
+// A stateful allocator three pointers wide, larger than the small buffer
+// would leave room for next to a pointer.
+template < typename T >
+struct WideAllocator
+{
+    using value_type = T;
+
+    CountingResource* resource;
+    void*             padding[ 2 ] = {};
+
+    explicit WideAllocator( CountingResource* r ) noexcept :
+        resource( r )
+    {}
+    template < typename U >
+    WideAllocator( const WideAllocator< U >& other ) noexcept :
+        resource( other.resource )
+    {}
+
+    T* allocate( std::size_t n )
+    {
+        return static_cast< T* >( resource->allocate( n * sizeof( T ), alignof( T ) ) );
+    }
+    void deallocate( T* p, std::size_t n ) noexcept
+    {
+        resource->deallocate( p, n * sizeof( T ), alignof( T ) );
+    }
+
+    friend bool operator==( const WideAllocator& lhs, const WideAllocator& rhs ) noexcept
+    {
+        return lhs.resource == rhs.resource;
+    }
+};
+
+struct LargeCapture
+{
+    std::array< int, 32 > payload {};
+
+    int operator()( int x ) const
+    {
+        return payload[ 0 ] + x;
+    }
+};
+
+} // namespace
+
+TEST_CASE( "non_null_move_only_function - allocator construction", "[non_null_move_only_function][allocator]" )
+{
+    CountingResource pool;
+
+    SECTION( "large capture is allocated from the resource" )
+    {
+        {
+            nova::non_null_move_only_function< int( int ) > fn( std::allocator_arg, &pool, LargeCapture { { 40 } } );
+            CHECK( pool.allocations == 1 );
+            CHECK( fn( 2 ) == 42 );
+
+            // take() hands the allocated callable to the std wrapper; it is freed through the pool
+            std::move_only_function< int( int ) > raw = take( std::move( fn ) );
+            CHECK( raw( 1 ) == 41 );
+            CHECK( pool.deallocations == 0 );
+        }
+        CHECK( pool.deallocations == 1 );
+    }
+
+    SECTION( "small capture does not touch the allocator" )
+    {
+        auto small = [ x = 7 ] {
+            return x;
+        };
+        nova::non_null_move_only_function< int() > fn( std::allocator_arg, &pool, small );
+        CHECK( fn() == 7 );
+
+        // Outside libstdc++ nothing but function pointers and reference_wrapper
+        // is known to be stored inline, so the capture goes to the pool.
+        constexpr bool known_inline
+            = nova::detail::move_only_function_stores_inline< decltype( small ), std::move_only_function< int() > >();
+        CHECK( pool.allocations == ( known_inline ? 0 : 1 ) );
+    }
+
+    SECTION( "allocator overload and move-only capture" )
+    {
+        {
+            std::pmr::polymorphic_allocator< int >          alloc( &pool );
+            nova::non_null_move_only_function< int() && > fn(
+                std::allocator_arg, alloc, [ big = LargeCapture { { 5 } }, p = std::make_unique< int >( 1 ) ] {
+                    return big( *p );
+                } );
+            CHECK( pool.allocations == 1 );
+            CHECK( std::move( fn )() == 6 );
+        }
+        CHECK( pool.deallocations == 1 );
+    }
+
+    SECTION( "the handle stays one pointer with a wide allocator" )
+    {
+        static_assert( sizeof( nova::detail::allocated_callable< LargeCapture, WideAllocator< int > > )
+                       == sizeof( void* ) );
+        {
+            nova::non_null_move_only_function< int( int ) > fn(
+                std::allocator_arg, WideAllocator< int >( &pool ), LargeCapture { { 40 } } );
+            CHECK( pool.allocations == 1 );
+            CHECK( fn( 2 ) == 42 );
+        }
+        CHECK( pool.deallocations == 1 );
+    }
+
+    SECTION( "qualified signatures" )
+    {
+        const nova::non_null_move_only_function< int( int ) const noexcept > fn(
+            std::allocator_arg, &pool, [ big = LargeCapture { { 1 } } ]( int x ) noexcept {
+                return big.payload[ 0 ] + x;
+            } );
+        static_assert( noexcept( fn( 1 ) ) );
+        CHECK( fn( 1 ) == 2 );
+        CHECK( pool.allocations == 1 );
+    }
+
+    SECTION( "contract policy checks the callable" )
+    {
+        using checked = nova::non_null_move_only_function< int( int ), nova::contract_throw >;
+        CHECK_THROWS_AS( checked( std::allocator_arg, &pool, std::move_only_function< int( int ) >() ),
+                         nova::contract_violation_error );
+
+        // A nullable source that is not stored inline must not hide its emptiness.
+        CHECK_THROWS_AS( checked( std::allocator_arg, &pool, std::move_only_function< int( int ) const >() ),
+                         nova::contract_violation_error );
+        CHECK_THROWS_AS( checked( std::allocator_arg, &pool, std::function< int( int ) >() ),
+                         nova::contract_violation_error );
+        CHECK( pool.allocations == 0 );
+    }
+}
+
+#    if defined( __cpp_lib_copyable_function )
+
+TEST_CASE( "non_null_copyable_function", "[non_null_copyable_function]" )
+{
+    nova::non_null_copyable_function< int( int ) const noexcept > fn( []( int x ) noexcept {
+        return x + 10;
+    } );
+    static_assert( noexcept( fn( 1 ) ) );
+    CHECK( fn( 1 ) == 11 );
+
+    auto copy = fn;
+    CHECK( copy( 2 ) == 12 );
+
+    nova::non_null_copyable_function< int( int ) const noexcept > other( []( int x ) noexcept {
+        return x;
+    } );
+    other = copy;
+    CHECK( other( 3 ) == 13 );
+
+    std::copyable_function< int( int ) const noexcept > raw = take( std::move( copy ) );
+    CHECK( raw( 4 ) == 14 );
+}
+
+static_assert( std::is_copy_constructible_v< nova::non_null_copyable_function< int() > > );
+static_assert( std::is_copy_assignable_v< nova::non_null_copyable_function< int() > > );
+static_assert( !std::is_move_constructible_v< nova::non_null_copyable_function< int() > > );
+static_assert( !std::is_constructible_v< nova::non_null_copyable_function< int() >, std::nullptr_t > );
+
+#    endif // __cpp_lib_copyable_function
+
+#endif // __cpp_lib_move_only_function
+
+// =============================================================================
+// inplace_function / non_null_inplace_function tests
+// =============================================================================
+
+TEST_CASE( "inplace_function - empty and engaged states", "[inplace_function]" )
+{
+    nova::inplace_function< int( int ) > empty;
+    CHECK_FALSE( static_cast< bool >( empty ) );
+    CHECK( empty == nullptr );
+
+    using fn_ptr = int ( * )( int );
+    nova::inplace_function< int( int ) > from_null_ptr( fn_ptr { nullptr } );
+    CHECK_FALSE( static_cast< bool >( from_null_ptr ) );
+
+    nova::inplace_function< int( int ) > from_empty_function( std::function< int( int ) > {} );
+    CHECK_FALSE( static_cast< bool >( from_empty_function ) );
+
+    nova::inplace_function< int( int ), 64 > from_empty_inplace( nova::inplace_function< int( int ) > {} );
+    CHECK_FALSE( static_cast< bool >( from_empty_inplace ) );
+
+    nova::inplace_function< int( int ) > fn = []( int x ) {
+        return x + 1;
+    };
+    CHECK( static_cast< bool >( fn ) );
+    CHECK( fn( 41 ) == 42 );
+
+    fn = nullptr;
+    CHECK_FALSE( static_cast< bool >( fn ) );
+}
+
+TEST_CASE( "inplace_function - move relocates the callable", "[inplace_function]" )
+{
+    auto                            up = std::make_unique< int >( 42 );
+    nova::inplace_function< int() > fn1( [ p = std::move( up ) ] {
+        return *p;
+    } );
+    nova::inplace_function< int() > fn2( std::move( fn1 ) );
+    CHECK_FALSE( static_cast< bool >( fn1 ) );
+    CHECK( fn2() == 42 );
+
+    nova::inplace_function< int() > fn3;
+    fn3 = std::move( fn2 );
+    CHECK_FALSE( static_cast< bool >( fn2 ) );
+    CHECK( fn3() == 42 );
+}
+
+TEST_CASE( "inplace_function - destroys the stored callable", "[inplace_function]" )
+{
+    auto counter = std::make_shared< int >( 0 );
+    {
+        nova::inplace_function< void() > fn( [ counter ] {} );
+        CHECK( counter.use_count() == 2 );
+
+        nova::inplace_function< void() > other( std::move( fn ) );
+        CHECK( counter.use_count() == 2 );
+    }
+    CHECK( counter.use_count() == 1 );
+}
+
+TEST_CASE( "inplace_function - custom capacity and alignment", "[inplace_function]" )
+{
+    struct alignas( 32 ) Big
+    {
+        char payload[ 64 ] = {};
+        int  operator()() const
+        {
+            return sizeof( payload );
+        }
+    };
+
+    nova::inplace_function< int(), sizeof( Big ), alignof( Big ) > fn( Big {} );
+    CHECK( fn() == 64 );
+
+    static_assert( decltype( fn )::capacity == sizeof( Big ) );
+    static_assert( decltype( fn )::alignment == alignof( Big ) );
+    static_assert( alignof( decltype( fn ) ) == alignof( Big ) );
+}
+
+TEST_CASE( "non_null_inplace_function - construction from lambda", "[non_null_inplace_function]" )
+{
+    nova::non_null_inplace_function< int( int ) > fn( []( int x ) {
+        return x * 2;
+    } );
+    CHECK( fn( 21 ) == 42 );
+    CHECK( static_cast< bool >( fn ) );
+}
+
+TEST_CASE( "non_null_inplace_function - move-only capture", "[non_null_inplace_function]" )
+{
+    auto                                     up = std::make_unique< int >( 99 );
+    nova::non_null_inplace_function< int() > fn( [ p = std::move( up ) ]() {
+        return *p;
+    } );
+    CHECK( fn() == 99 );
+}
+
+TEST_CASE( "non_null_inplace_function - take() and re-wrap", "[non_null_inplace_function]" )
+{
+    nova::non_null_inplace_function< int() > fn1( [] {
+        return 7;
+    } );
+    auto                                     raw = take( std::move( fn1 ) );
+    static_assert( std::is_same_v< decltype( raw ), nova::inplace_function< int() > > );
+    CHECK( static_cast< bool >( raw ) );
+
+    nova::non_null_inplace_function< int() > fn2( std::move( raw ) );
+    CHECK( fn2() == 7 );
+}
+
+TEST_CASE( "non_null_inplace_function - swap", "[non_null_inplace_function]" )
+{
+    nova::non_null_inplace_function< int() > fn1( [] {
+        return 1;
+    } );
+    nova::non_null_inplace_function< int() > fn2( [] {
+        return 2;
+    } );
+    fn1.swap( fn2 );
+    CHECK( fn1() == 2 );
+    CHECK( fn2() == 1 );
+
+    using std::swap;
+    swap( fn1, fn2 );
+    CHECK( fn1() == 1 );
+    CHECK( fn2() == 2 );
+}
+
+TEST_CASE( "non_null_inplace_function - underlying() accessor", "[non_null_inplace_function]" )
+{
+    nova::non_null_inplace_function< int( int ) > fn( []( int x ) {
+        return x;
+    } );
+    const nova::inplace_function< int( int ) >&   underlying = fn.underlying();
+    CHECK( static_cast< bool >( underlying ) );
+}
+
+static_assert( std::is_same_v< nova::non_null_inplace_function< int( double ), 64 >::function_type,
+                               nova::inplace_function< int( double ), 64 > > );
+static_assert( sizeof( nova::inplace_function< void(), 16, 8 > ) == 16 + sizeof( void* ) );
+
+static_assert( !std::is_copy_constructible_v< nova::non_null_inplace_function< int() > > );
+static_assert( !std::is_copy_assignable_v< nova::non_null_inplace_function< int() > > );
+static_assert( !std::is_move_constructible_v< nova::non_null_inplace_function< int() > > );
+static_assert( !std::is_move_assignable_v< nova::non_null_inplace_function< int() > > );
+static_assert( !std::is_constructible_v< nova::non_null_inplace_function< int() >, std::nullptr_t > );
+static_assert( std::is_nothrow_move_constructible_v< nova::inplace_function< int() > > );
+
+#if defined( __cpp_lib_move_only_function ) && __cpp_lib_move_only_function >= 202110L
+
+// =============================================================================
+// non_null_task_queue
+// =============================================================================
+
+TEST_CASE( "non_null_task_queue - push and run in order", "[non_null_task_queue]" )
+{
+    nova::non_null_task_queue< 4 > queue;
+    std::vector< int >            order;
+
+    CHECK( queue.empty() );
+    CHECK_FALSE( queue.try_run_one() );
+
+    nova::non_null_move_only_function< void() > first( [ & ] {
+        order.push_back( 1 );
+    } );
+    CHECK( queue.try_push( std::move( first ) ) );
+
+    nova::non_null_inplace_function< void(), nova::task_queue_default_task_capacity > second( [ & ] {
+        order.push_back( 2 );
+    } );
+    CHECK( queue.try_push( std::move( second ) ) );
+
+    CHECK( queue.try_emplace( [ &order, p = std::make_unique< int >( 3 ) ] {
+        order.push_back( *p );
+    } ) );
+
+    CHECK_FALSE( queue.empty() );
+    CHECK( queue.run_pending() == 3 );
+    CHECK( order == std::vector< int > { 1, 2, 3 } );
+    CHECK( queue.empty() );
+}
+
+TEST_CASE( "non_null_task_queue - full queue leaves the task with the caller", "[non_null_task_queue]" )
+{
+    nova::non_null_task_queue< 2 > queue;
+    int                            runs = 0;
+    auto                           task = [ &runs ] {
+        ++runs;
+    };
+
+    CHECK( queue.try_emplace( task ) );
+    CHECK( queue.try_emplace( task ) );
+    CHECK_FALSE( queue.try_emplace( task ) );
+
+    nova::non_null_move_only_function< void() > rejected( task );
+    CHECK_FALSE( queue.try_push( std::move( rejected ) ) );
+    rejected();
+    CHECK( runs == 1 );
+
+    // The ring wraps around once slots are released.
+    CHECK( queue.try_run_one() );
+    queue.push( std::move( rejected ) );
+    CHECK( queue.run_pending() == 2 );
+    CHECK( runs == 4 );
+}
+
+TEST_CASE( "non_null_task_queue - slot is released when a task throws", "[non_null_task_queue]" )
+{
+    nova::non_null_task_queue< 2 > queue;
+    auto                           owned = std::make_shared< int >( 0 );
+
+    queue.emplace( [ owned ] {
+        throw std::runtime_error( "task failed" );
+    } );
+    CHECK( owned.use_count() == 2 );
+    CHECK_THROWS_AS( queue.try_run_one(), std::runtime_error );
+    CHECK( owned.use_count() == 1 );
+    CHECK( queue.empty() );
+
+    queue.emplace( [ owned ] {} );
+    queue.emplace( [ owned ] {} );
+    CHECK( queue.run_pending() == 2 );
+}
+
+TEST_CASE( "non_null_task_queue - pending tasks are destroyed with the queue", "[non_null_task_queue]" )
+{
+    auto owned = std::make_shared< int >( 0 );
+    {
+        nova::non_null_task_queue< 4 > queue;
+        queue.emplace( [ owned ] {} );
+        queue.emplace( [ owned ] {} );
+        CHECK( owned.use_count() == 3 );
+    }
+    CHECK( owned.use_count() == 1 );
+}
+
+TEST_CASE( "non_null_task_queue - multiple producers", "[non_null_task_queue]" )
+{
+    constexpr int producer_count     = 4;
+    constexpr int tasks_per_producer = 2000;
+
+    nova::non_null_task_queue< 64 > queue;
+    std::atomic< long >             sum { 0 };
+    std::vector< int >              last_seen( producer_count, -1 );
+    bool                            in_order = true;
+
+    std::vector< std::thread > producers;
+    for ( int id = 0; id != producer_count; ++id ) {
+        producers.emplace_back( [ &, id ] {
+            for ( int i = 0; i != tasks_per_producer; ++i ) {
+                nova::non_null_move_only_function< void() > task( [ &, id, i ] {
+                    in_order        = in_order && last_seen[ id ] == i - 1;
+                    last_seen[ id ] = i;
+                    sum.fetch_add( i, std::memory_order_relaxed );
+                } );
+                queue.push( std::move( task ) );
+            }
+        } );
+    }
+
+    int run = 0;
+    while ( run != producer_count * tasks_per_producer )
+        run += static_cast< int >( queue.run_pending() );
+    for ( auto& t : producers )
+        t.join();
+
+    CHECK( in_order );
+    CHECK( sum.load() == long { producer_count } * ( tasks_per_producer * ( tasks_per_producer - 1 ) / 2 ) );
+    CHECK( queue.empty() );
+}
+
+static_assert( alignof( nova::non_null_task_queue< 8 > ) == 64 );
+static_assert( !std::is_copy_constructible_v< nova::non_null_task_queue< 8 > > );
+
 #endif // __cpp_lib_move_only_function
+
+// =============================================================================
+// contract policies
+// =============================================================================
+
+TEST_CASE( "non_null_function contract policies", "[non_null_function][contract]" )
+{
+    using checked = nova::non_null_function< int( int ), nova::contract_throw >;
+
+    checked fn( []( int x ) {
+        return x + 1;
+    } );
+    CHECK( fn( 1 ) == 2 );
+    CHECK_THROWS_AS( checked( std::function< int( int ) >() ), nova::contract_violation_error );
+
+    using trusted = nova::non_null_function< int( int ), nova::contract_trust >;
+    trusted t( fn.underlying() );
+    CHECK( t( 2 ) == 3 );
+
+#if defined( __cpp_lib_move_only_function ) && __cpp_lib_move_only_function >= 202110L
+    using checked_move_only = nova::non_null_move_only_function< int( int ), nova::contract_throw >;
+    CHECK_THROWS_AS( checked_move_only( std::move_only_function< int( int ) >() ), nova::contract_violation_error );
+
+    checked_move_only m( []( int x ) {
+        return x * 2;
+    } );
+    CHECK( m( 4 ) == 8 );
+#endif
+}
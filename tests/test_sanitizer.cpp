@@ -0,0 +1,408 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2026 Tim Blechmann
+
+// Built with -fsanitize=address,undefined as nova_nonnull_sanitizer_tests.
+// Every wrapper with take() goes through the operations that are legal on a
+// taken object -- assignment, swap and destruction -- which must neither
+// report nor leave poisoned storage behind. Without ASAN the poison checks
+// are skipped and the suite still checks the values.
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <nova/non_null.hpp>
+
+#if defined( __SANITIZE_ADDRESS__ )
+#    define NOVA_TEST_ASAN 1
+#elif defined( __has_feature )
+#    if __has_feature( address_sanitizer )
+#        define NOVA_TEST_ASAN 1
+#    endif
+#endif
+
+#ifdef NOVA_TEST_ASAN
+#    include <sanitizer/asan_interface.h>
+#endif
+
+namespace {
+
+#ifdef NOVA_TEST_ASAN
+constexpr bool asan_enabled = true;
+
+bool poisoned( const void* p, std::size_t size )
+{
+    return __asan_region_is_poisoned( const_cast< void* >( p ), size ) != nullptr;
+}
+#else
+constexpr bool asan_enabled = false;
+
+bool poisoned( const void*, std::size_t )
+{
+    return false;
+}
+#endif
+
+template < typename W >
+bool poisoned( const W& w )
+{
+    return poisoned( std::addressof( w ), sizeof( W ) );
+}
+
+struct Counted : nova::intrusive_ref_counter< Counted >
+{
+    explicit Counted( int v ) :
+        value( v )
+    {}
+
+    int value;
+};
+
+// Each case names a wrapper, makes one holding value and reads the value back.
+struct raw_case
+{
+    using type = nova::non_null< int* >;
+
+    static type make( int& value )
+    {
+        return type( &value );
+    }
+    static int read( const type& w )
+    {
+        return *w;
+    }
+};
+
+struct unique_case
+{
+    using type = nova::non_null_unique_ptr< int >;
+
+    static type make( int& value )
+    {
+        return nova::make_non_null_unique< int >( value );
+    }
+    static int read( const type& w )
+    {
+        return *w;
+    }
+};
+
+struct shared_case
+{
+    using type = nova::non_null_shared_ptr< int >;
+
+    static type make( int& value )
+    {
+        return nova::make_non_null_shared< int >( value );
+    }
+    static int read( const type& w )
+    {
+        return *w;
+    }
+};
+
+struct intrusive_case
+{
+    using type = nova::non_null_intrusive_ptr< Counted >;
+
+    static type make( int& value )
+    {
+        return nova::make_non_null_intrusive< Counted >( value );
+    }
+    static int read( const type& w )
+    {
+        return w->value;
+    }
+};
+
+struct allocated_case
+{
+    using type = nova::non_null_allocated_unique_ptr< int, std::allocator< int > >;
+
+    static type make( int& value )
+    {
+        return nova::allocate_non_null_unique< int >( std::allocator< int > {}, value );
+    }
+    static int read( const type& w )
+    {
+        return *w;
+    }
+};
+
+struct trivial_unique_case
+{
+    using type = nova::non_null_trivial_unique_ptr< int >;
+
+    static type make( int& value )
+    {
+        return type( new int( value ) );
+    }
+    static int read( const type& w )
+    {
+        return *w;
+    }
+};
+
+struct function_case
+{
+    using type = nova::non_null_function< int() >;
+
+    static type make( int& value )
+    {
+        return type( [ value ] {
+            return value;
+        } );
+    }
+    static int read( const type& w )
+    {
+        return w();
+    }
+};
+
+struct inplace_case
+{
+    using type = nova::non_null_inplace_function< int() >;
+
+    static type make( int& value )
+    {
+        return type( [ value ] {
+            return value;
+        } );
+    }
+    static int read( type& w )
+    {
+        return w();
+    }
+};
+
+#if defined( __cpp_lib_move_only_function ) && __cpp_lib_move_only_function >= 202110L
+struct move_only_case
+{
+    using type = nova::non_null_move_only_function< int() >;
+
+    static type make( int& value )
+    {
+        return type( [ value, owner = std::make_unique< int >( value ) ] {
+            return value;
+        } );
+    }
+    static int read( type& w )
+    {
+        return w();
+    }
+};
+#endif
+
+#if defined( __cpp_lib_copyable_function )
+struct copyable_case
+{
+    using type = nova::non_null_copyable_function< int() >;
+
+    static type make( int& value )
+    {
+        return type( [ value ] {
+            return value;
+        } );
+    }
+    static int read( type& w )
+    {
+        return w();
+    }
+};
+#endif
+
+} // namespace
+
+#define NOVA_SANITIZER_CASES                                                                                       \
+    raw_case, unique_case, shared_case, intrusive_case, allocated_case, trivial_unique_case, function_case,        \
+        inplace_case
+
+TEMPLATE_TEST_CASE( "take() poisons the source, destruction unpoisons it", "[sanitizer]", NOVA_SANITIZER_CASES )
+{
+    using W   = typename TestType::type;
+    int value = 7;
+
+    alignas( W ) unsigned char storage[ sizeof( W ) ];
+    W*                         w = ::new ( static_cast< void* >( storage ) ) W( TestType::make( value ) );
+    CHECK_FALSE( poisoned( *w ) );
+
+    auto inner = take( std::move( *w ) );
+    CHECK( poisoned( *w ) == asan_enabled );
+
+    // The taken wrapper is destroyed normally and hands back clean storage, so
+    // reusing the bytes does not report.
+    std::destroy_at( w );
+    CHECK_FALSE( poisoned( storage, sizeof( storage ) ) );
+
+    // What take() returned is intact and can be wrapped again.
+    W again( std::move( inner ) );
+    CHECK( TestType::read( again ) == 7 );
+}
+
+TEMPLATE_TEST_CASE( "swap leaves both wrappers unpoisoned", "[sanitizer]", NOVA_SANITIZER_CASES )
+{
+    int a = 1, b = 2;
+    auto x = TestType::make( a );
+    auto y = TestType::make( b );
+
+    swap( x, y );
+    CHECK( TestType::read( x ) == 2 );
+    CHECK( TestType::read( y ) == 1 );
+    x.swap( y );
+    CHECK( TestType::read( x ) == 1 );
+    CHECK_FALSE( poisoned( x ) );
+    CHECK_FALSE( poisoned( y ) );
+}
+
+TEMPLATE_TEST_CASE( "assigning to a taken wrapper revives it",
+                    "[sanitizer]",
+                    raw_case,
+                    shared_case,
+                    intrusive_case,
+                    trivial_unique_case,
+                    function_case )
+{
+    using W = typename TestType::type;
+    int a = 3, b = 4;
+    W   x = TestType::make( a );
+    W   y = TestType::make( b );
+
+    auto inner = take( std::move( x ) );
+    if constexpr ( std::is_copy_assignable_v< W > )
+        x = y;
+    else
+        x = std::move( y );
+    CHECK_FALSE( poisoned( x ) );
+    CHECK( TestType::read( x ) == 4 );
+
+    // A revived wrapper can be taken and swapped again.
+    W z = TestType::make( a );
+    swap( x, z );
+    CHECK( TestType::read( x ) == 3 );
+    CHECK( TestType::read( z ) == 4 );
+    (void)inner;
+}
+
+TEST_CASE( "a moved-from non_null_trivial_unique_ptr is poisoned like a taken one", "[sanitizer]" )
+{
+    nova::non_null_trivial_unique_ptr< int > src( new int( 5 ) );
+    nova::non_null_trivial_unique_ptr< int > dst = std::move( src );
+    CHECK( poisoned( src ) == asan_enabled );
+    CHECK( *dst == 5 );
+
+    src = std::move( dst );
+    CHECK_FALSE( poisoned( src ) );
+    CHECK( poisoned( dst ) == asan_enabled );
+}
+
+#if defined( __cpp_lib_move_only_function ) && __cpp_lib_move_only_function >= 202110L
+
+TEST_CASE( "non_null_vector::push_back of an rvalue poisons only move-only sources", "[sanitizer]" )
+{
+    int                           value = 6;
+    nova::non_null_vector< int* > raw;
+    nova::non_null< int* >        p( &value );
+    raw.push_back( std::move( p ) );
+    CHECK_FALSE( poisoned( p ) );
+    CHECK( *p == 6 );
+
+    nova::non_null_vector< std::shared_ptr< int > > shared;
+    auto                                            sp = nova::make_non_null_shared< int >( 7 );
+    shared.push_back( std::move( sp ) );
+    CHECK_FALSE( poisoned( sp ) );
+    CHECK( *shared.back() == 7 );
+
+    nova::non_null_vector< std::unique_ptr< int > > unique;
+    auto                                            up = nova::make_non_null_unique< int >( 8 );
+    unique.push_back( std::move( up ) );
+    CHECK( poisoned( up ) == asan_enabled );
+    CHECK( *unique.back() == 8 );
+}
+
+TEST_CASE( "take() on non_null_move_only_function", "[sanitizer]" )
+{
+    int value = 8;
+    using W   = move_only_case::type;
+
+    alignas( W ) unsigned char storage[ sizeof( W ) ];
+    W*                         w = ::new ( static_cast< void* >( storage ) ) W( move_only_case::make( value ) );
+
+    auto inner = take( std::move( *w ) );
+    CHECK( poisoned( *w ) == asan_enabled );
+    CHECK( inner() == 8 );
+    std::destroy_at( w );
+    CHECK_FALSE( poisoned( storage, sizeof( storage ) ) );
+
+    int  a = 1, b = 2;
+    auto x = move_only_case::make( a );
+    auto y = move_only_case::make( b );
+    swap( x, y );
+    CHECK( move_only_case::read( x ) == 2 );
+    CHECK_FALSE( poisoned( y ) );
+}
+
+#endif // __cpp_lib_move_only_function
+
+#if defined( __cpp_lib_copyable_function )
+
+TEST_CASE( "take() on non_null_copyable_function", "[sanitizer]" )
+{
+    int  a = 1, b = 2;
+    auto x = copyable_case::make( a );
+    auto y = copyable_case::make( b );
+
+    auto inner = take( std::move( x ) );
+    CHECK( poisoned( x ) == asan_enabled );
+    x = y;
+    CHECK_FALSE( poisoned( x ) );
+    CHECK( copyable_case::read( x ) == 2 );
+    CHECK( inner() == 1 );
+}
+
+#endif // __cpp_lib_copyable_function
+
+// =============================================================================
+// constexpr take() in sanitised builds
+// =============================================================================
+
+namespace {
+
+constexpr int static_value = 9;
+
+constexpr bool take_raw()
+{
+    nova::non_null< const int* > p( &static_value );
+    nova::non_null< const int* > q = p;
+    const int*                   r = take( std::move( p ) );
+    p                              = q;
+    p.swap( q );
+    return r == &static_value && p.get() == &static_value;
+}
+
+static_assert( take_raw() );
+
+#if defined( __cpp_lib_constexpr_memory ) && __cpp_lib_constexpr_memory >= 202202L
+constexpr bool take_unique()
+{
+    auto                   nn = nova::make_non_null_unique< int >( 3 );
+    std::unique_ptr< int > up = take( std::move( nn ) );
+    return *up == 3;
+}
+
+constexpr bool take_trivial_unique()
+{
+    nova::non_null_trivial_unique_ptr< int > p( new int( 4 ) );
+    nova::non_null_trivial_unique_ptr< int > q = std::move( p );
+    std::unique_ptr< int >                   up = take( std::move( q ) );
+    return *up == 4;
+}
+
+static_assert( take_unique() );
+static_assert( take_trivial_unique() );
+#endif
+
+} // namespace